@@ -23,12 +23,66 @@
 #ifndef I2C_H_
 #define I2C_H_
 
+#include "i2c_timing.h"
+
+
+//! @brief Data sent on one lane by i2c_dual_write(): head bytes, then rows of a buffer.
+//!        A plain buffer is one row.
+typedef struct _i2c_lane
+{
+    const uint8_t *head;    //!< Bytes sent first, usually slave address and control byte
+    uint8_t head_len;       //!< Number of head bytes
+    const uint8_t *buf;     //!< First row of data
+    uint16_t len;           //!< Bytes per row
+    uint16_t stride;        //!< Distance between rows in buf
+    uint8_t rows;           //!< Number of rows
+} i2c_lane_t;
+
+
+//! @brief Status of an asynchronous transaction
+typedef enum
+{
+    I2C_ASYNC_PENDING = 0,  //!< Queued
+    I2C_ASYNC_BUSY,         //!< On the bus
+    I2C_ASYNC_OK,           //!< Completed
+    I2C_ASYNC_NACK,         //!< Ended early, slave did not ACK
+} i2c_async_status_t;
+
+struct _i2c_async_xfer;
+
+//! @brief Completion callback of an asynchronous transaction. Runs in the timer interrupt, keep it short.
+typedef void (*i2c_async_cb_t)(struct _i2c_async_xfer *xfer, void *arg);
+
+//! @brief Asynchronous transaction descriptor: START, address+W, write data, repeated START,
+//!        address+R, read data, STOP. Either phase is skipped if its length is 0. With both lengths 0
+//!        only address+W is sent, a probe that ends I2C_ASYNC_OK if the slave ACKs. The descriptor and
+//!        its buffers must stay valid until the callback runs.
+typedef struct _i2c_async_xfer
+{
+    struct _i2c_async_xfer *next;   //!< Queue link, used by the engine
+    uint8_t address;                //!< 8-bit slave address, R/W bit is filled in
+    const uint8_t *wbuf;            //!< Data to write
+    uint16_t wlen;                  //!< Number of bytes to write
+    uint8_t *rbuf;                  //!< Buffer receiving data
+    uint16_t rlen;                  //!< Number of bytes to read
+    i2c_async_cb_t cb;              //!< Called when the transaction ends, can be NULL
+    void *arg;                      //!< Argument passed to cb
+    volatile i2c_async_status_t status; //!< Set by the engine
+    volatile uint16_t done;         //!< Bytes written (ACK'ed) plus read, set by the engine
+} i2c_async_xfer_t;
 
 /**
- * @brief   Initialize I2C GPIO pins
+ * @brief   Initialize I2C GPIO pins, bus speed defaults to I2C_DEFAULT_SPEED
  */
 void i2c_init(void);
 
+/**
+ * @brief   Select bus speed. Bit timing is derived from the current CPU clock, so call again
+ *          after changing CPU frequency between 80MHz and 160MHz.
+ * @param   speed   Standard (100kHz), Fast (400kHz) or Fast mode plus (1MHz)
+ */
+void i2c_set_speed(i2c_speed_t speed);
+
 /**
  * @brief   Send I2C start bit
  * @return  true if start successfully. Otherwise the bus is busy
@@ -47,6 +101,14 @@ void i2c_stop(void);
  */
 bool i2c_write(uint8_t data);
 
+/**
+ * @brief    Send a run of bytes to I2C bus, stops at the first byte not ACK'ed
+ * @param    buf Data to send
+ * @param    len Number of bytes to send
+ * @return   Number of bytes ACK'ed. Less than len if the slave NACK'ed
+ */
+uint16_t i2c_write_buf(const uint8_t *buf, uint16_t len);
+
 /**
  * @brief    Read data from I2C bus
  * @return   Data read
@@ -59,5 +121,66 @@ uint8_t i2c_read(void);
  */
 void i2c_set_ack(bool ack);
 
+/**
+ * @brief    Read a run of bytes from I2C bus. Every byte is ACK'ed except the last one, which is NACK'ed
+ * @param    buf Buffer receiving data
+ * @param    len Number of bytes to read
+ * @return   Number of bytes read
+ */
+uint16_t i2c_read_buf(uint8_t *buf, uint16_t len);
+
+/**
+ * @brief    Complete write-then-read transaction: START, address+W, write data, repeated START,
+ *           address+R, read data, STOP. Either phase is skipped if its length is 0.
+ * @param    address    8-bit slave address, R/W bit is filled in
+ * @param    wbuf       Data to write
+ * @param    wlen       Number of bytes to write
+ * @param    rbuf       Buffer receiving data
+ * @param    rlen       Number of bytes to read
+ * @return   Number of bytes written (ACK'ed) plus read. Less than wlen + rlen on a partial transfer,
+ *           0 if the bus is busy or the slave did not respond
+ */
+uint16_t i2c_write_read(uint8_t address, const uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen);
+
+/**
+ * @brief    Select SDA lane used by the single lane functions above
+ * @param    lane 0 or 1. Lane 1 is only available if I2C_DUAL_LANE is enabled in i2c.c, otherwise
+ *                selecting it reports an error and lane 0 stays selected
+ */
+void i2c_select_lane(uint8_t lane);
+
+/**
+ * @brief    Run one write transaction on each lane at the same time (START, data, STOP), both lanes
+ *           clocked by the shared SCL. The lane that finishes first is stopped while the other
+ *           lane keeps going.
+ * @param    lane0  Data for lane 0, NULL to leave lane 0 idle
+ * @param    lane1  Data for lane 1, NULL to leave lane 1 idle
+ * @param    acked  Receives number of bytes ACK'ed on each lane, head included. A lane stops at its
+ *                  first NACK
+ * @return   true if the transfer ran, false if the bus is busy or I2C_DUAL_LANE is not enabled
+ */
+bool i2c_dual_write(const i2c_lane_t *lane0, const i2c_lane_t *lane1, uint16_t acked[2]);
+
+/**
+ * @brief    Queue a transaction for the asynchronous engine and return. The engine runs it from the
+ *           FRC1 timer interrupt a few bus phases at a time, and calls the descriptor's callback when done.
+ * @param    xfer   Transaction descriptor
+ * @remark   Do not use the single lane functions while i2c_async_busy() returns true
+ */
+void i2c_async_submit(i2c_async_xfer_t *xfer);
+
+/**
+ * @brief    Set asynchronous engine throughput. Each interrupt holds the CPU for about
+ *           phases bus half periods, so keep that short enough for WiFi.
+ * @param    tick_us    FRC1 interrupt period in microseconds
+ * @param    phases     Bus phases (half bits) per interrupt, 18 moves one byte
+ */
+void i2c_async_config(uint16_t tick_us, uint8_t phases);
+
+/**
+ * @brief    Check if the asynchronous engine has transactions queued or running
+ */
+bool i2c_async_busy(void);
+
 
 #endif
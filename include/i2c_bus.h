@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * @file    i2c_bus.h
+  * @author  Baoshi <mail(at)ba0sh1(dot)com>
+  * @version 0.1
+  * @date    Dec 24, 2014
+  * @brief   Shared I2C bus manager. Owns i2c.c and runs whole transactions for
+  *          any task, one at a time and highest priority first.
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Copyright (c) 2015, Baoshi Zhu. All rights reserved.
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#ifndef I2C_BUS_H_
+#define I2C_BUS_H_
+
+
+//! @brief Transaction priority. Waiting transactions are run highest priority first, in order of
+//!        submission within the same priority.
+typedef enum
+{
+    I2C_BUS_PRIO_BULK = 0,  //!< Large transfers, e.g. full screen refresh
+    I2C_BUS_PRIO_NORMAL,    //!< Device access, e.g. EEPROM
+    I2C_BUS_PRIO_UI,        //!< Short updates that should not wait behind bulk transfers
+} i2c_bus_prio_t;
+
+
+#define I2C_SEG_WRITE       0x00    //!< Segment writes wbuf
+#define I2C_SEG_READ        0x01    //!< Segment reads into rbuf, the last byte is NACK'ed
+#define I2C_SEG_CONTINUE    0x02    //!< Write segment carries on from the previous one, no START or address
+
+//! @brief One segment of a transaction. Every segment starts with a (repeated) START and the slave
+//!        address, unless I2C_SEG_CONTINUE is set. The transaction ends with a STOP.
+typedef struct _i2c_bus_seg
+{
+    uint8_t flags;          //!< I2C_SEG_xxx
+    uint8_t address;        //!< 8-bit slave address, R/W bit is filled in
+    uint16_t len;           //!< Number of bytes to transfer, can be 0 (address only)
+    const uint8_t *wbuf;    //!< Data to write
+    uint8_t *rbuf;          //!< Buffer receiving data
+} i2c_bus_seg_t;
+
+//! @brief Function run by i2c_bus_run() with the bus held
+typedef void (*i2c_bus_fn_t)(void *arg);
+
+
+/**
+ * @brief   Start bus manager task. Call after i2c_init(). Transactions submitted before this run
+ *          directly on the calling task.
+ * @return  true if successful
+ */
+bool i2c_bus_init(void);
+
+/**
+ * @brief   Run a transaction and wait for it to finish. The transaction is atomic: nothing else is
+ *          put on the bus between its START and its STOP.
+ * @param   lane    SDA lane, see i2c_select_lane()
+ * @param   prio    Priority against other waiting transactions
+ * @param   segs    Segments, must stay valid until the function returns
+ * @param   count   Number of segments
+ * @return  true if the slave ACK'ed every byte written and all bytes were read. False if the bus is
+ *          busy, the slave did not respond or the transfer ended early
+ */
+bool i2c_bus_transfer(uint8_t lane, i2c_bus_prio_t prio, const i2c_bus_seg_t *segs, uint8_t count);
+
+/**
+ * @brief   Write-then-read transaction on lane 0, see i2c_write_read(). Either phase is skipped if
+ *          its length is 0.
+ * @return  true if all bytes were written and read
+ */
+bool i2c_bus_write_read(i2c_bus_prio_t prio, uint8_t address, const uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen);
+
+/**
+ * @brief   Run a function from the bus manager with the bus held, and wait for it to return. For
+ *          access the segment list cannot describe, e.g. i2c_dual_write().
+ * @param   prio    Priority against other waiting transactions
+ * @param   fn      Function to run, may use all functions of i2c.h
+ * @param   arg     Argument passed to fn
+ * @remark  Asynchronous transactions (i2c_async_submit()) do not go through the manager. Submit them
+ *          from fn so they do not cut into a transaction on the bus; the manager lets them finish
+ *          before it starts the next transaction.
+ */
+void i2c_bus_run(i2c_bus_prio_t prio, i2c_bus_fn_t fn, void *arg);
+
+
+#endif
@@ -0,0 +1,129 @@
+/**
+  ******************************************************************************
+  * @file    i2c_timing.h
+  * @author  Baoshi <mail(at)ba0sh1(dot)com>
+  * @version 0.1
+  * @date    Dec 24, 2014
+  * @brief   I2C bus timing in CPU cycles. Shared by the bit-bang engine in i2c.c
+  *          and the host timing check in tools/, so keep it free of SDK calls.
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Copyright (c) 2015, Baoshi Zhu. All rights reserved.
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#ifndef I2C_TIMING_H_
+#define I2C_TIMING_H_
+
+
+//! @brief I2C bus speed
+typedef enum
+{
+    I2C_SPEED_STANDARD = 0,     //!< Standard mode, 100kHz
+    I2C_SPEED_FAST = 1,         //!< Fast mode, 400kHz
+    I2C_SPEED_FAST_PLUS = 2,    //!< Fast mode plus, 1MHz. Needs strong pull-ups (Fm+ allows 20mA sink)
+} i2c_speed_t;
+
+
+//! @brief Minimum bus timing of one speed mode in nanoseconds (I2C-bus specification UM10204, table 10)
+typedef struct _i2c_spec
+{
+    uint32_t freq;      //!< Maximum SCL frequency (Hz)
+    uint16_t low;       //!< tLOW, SCL low period
+    uint16_t high;      //!< tHIGH, SCL high period
+    uint16_t hd_sta;    //!< tHD;STA, hold time after (repeated) START
+    uint16_t su_sta;    //!< tSU;STA, setup time for repeated START
+    uint16_t su_sto;    //!< tSU;STO, setup time for STOP
+    uint16_t buf;       //!< tBUF, bus free time between STOP and START
+    uint16_t rise;      //!< tr, maximum rise time allowed
+} i2c_spec_t;
+
+
+//! @brief Bus timing of one speed mode converted to CPU cycles to wait in each phase
+typedef struct _i2c_timing
+{
+    uint16_t low;       //!< SCL low phase
+    uint16_t high;      //!< SCL high phase
+    uint16_t hd_sta;    //!< START hold
+    uint16_t su_sta;    //!< START setup
+    uint16_t su_sto;    //!< STOP setup
+    uint16_t buf;       //!< Bus free after STOP
+} i2c_timing_t;
+
+
+static const i2c_spec_t i2c_specs[] =
+{
+    // freq     low   high  hd_sta su_sta su_sto buf   rise
+    {  100000,  4700, 4000, 4000,  4700,  4000,  4700, 1000 },  // Standard
+    {  400000,  1300,  600,  600,   600,   600,  1300,  300 },  // Fast
+    { 1000000,   500,  260,  260,   260,   260,   500,  120 },  // Fast plus
+};
+
+
+//! @brief Nanoseconds to CPU cycles at cpu_mhz, rounded up so a phase is never shorter than asked
+#define I2C_NS_TO_CYCLES(ns, cpu_mhz) (((uint32_t)(ns) * (cpu_mhz) + 999) / 1000)
+
+//! @brief CPU cycles from the end of a phase wait to the start of the next phase (GPIO write and CCOUNT read).
+//!        Taken off every phase budget. Underestimating only makes phases longer, never shorter.
+#define I2C_PHASE_OVERHEAD 10
+
+//! @brief Phase budget in CPU cycles, with the fixed per-phase overhead taken off
+#define I2C_PHASE_CYCLES(ns, cpu_mhz) \
+    ((I2C_NS_TO_CYCLES(ns, cpu_mhz) > I2C_PHASE_OVERHEAD) ? (I2C_NS_TO_CYCLES(ns, cpu_mhz) - I2C_PHASE_OVERHEAD) : 0)
+
+
+/**
+ * @brief   Calculate bus timing for a speed mode and CPU clock.
+ *          The SCL high phase is extended by the allowed rise time, since the pull-up takes that long
+ *          before the slave sees SCL high. Whatever is left of the clock period after the minimum low
+ *          and high phases is split evenly between them, so the bus runs at (not above) the nominal rate.
+ * @param   t           Timing to fill
+ * @param   speed       Speed mode
+ * @param   cpu_mhz     CPU clock in MHz (80 or 160)
+ */
+static inline void i2c_timing_calc(i2c_timing_t *t, i2c_speed_t speed, uint16_t cpu_mhz)
+{
+    const i2c_spec_t *s = &i2c_specs[speed];
+    uint32_t period = (1000000000UL + s->freq - 1) / s->freq;
+    uint32_t low = s->low, high = s->high + s->rise, slack;
+
+    if (period > low + high)
+    {
+        slack = period - low - high;
+        low += slack / 2;
+        high += slack - slack / 2;
+    }
+    t->low = I2C_PHASE_CYCLES(low, cpu_mhz);
+    t->high = I2C_PHASE_CYCLES(high, cpu_mhz);
+    t->hd_sta = I2C_PHASE_CYCLES(s->hd_sta, cpu_mhz);
+    t->su_sta = I2C_PHASE_CYCLES(s->su_sta + s->rise, cpu_mhz);
+    t->su_sto = I2C_PHASE_CYCLES(s->su_sto + s->rise, cpu_mhz);
+    t->buf = I2C_PHASE_CYCLES(s->buf, cpu_mhz);
+}
+
+
+/**
+ * @brief   Read CPU cycle counter
+ */
+#if defined(__XTENSA__)
+static inline uint32_t i2c_ccount(void)
+{
+    uint32_t r;
+    __asm__ __volatile__ ("rsr %0, ccount" : "=a"(r));
+    return r;
+}
+#else
+// Host build, the cycle counter is supplied by the timing model
+uint32_t i2c_ccount(void);
+#endif
+
+
+#endif
@@ -4,7 +4,7 @@
   * @author  Baoshi <mail(at)ba0sh1(dot)com>
   * @version 0.6
   * @date    Dec 29, 2014
-  * @brief   SSD1306 OLED driver interface for ESP8266. For panel
+  * @brief   SSD1305/SSD1306/SH1107 OLED driver interface for ESP8266. For panel
   *          configuration, edit the panel option block in oled_i2c.c
   *
   ******************************************************************************
@@ -28,6 +28,29 @@
 
 
 
+//! @brief Diff refresh statistics of the last refresh, together with the cost model used to build windows
+typedef struct _oled_diff_stats
+{
+    uint16_t window_cost;   //!< Bit times to address one window (COLUMNADDR/PAGEADDR and data framing)
+    uint16_t byte_cost;     //!< Bit times per data byte
+    uint16_t merge_gap;     //!< Longest run of unchanged bytes merged into a window rather than opening a new one
+    uint16_t compared;      //!< Bytes compared against the shadow frame
+    uint16_t changed;       //!< Bytes found changed
+    uint16_t sent;          //!< Bytes sent (changed bytes plus merged gaps)
+    uint16_t windows;       //!< Windows addressed
+    uint32_t bits;          //!< Bit times spent
+} oled_diff_stats_t;
+
+
+//! @brief Drawing coordinate. Wide enough for canvases larger than the panel and for shapes reaching
+//!        past its edges.
+typedef int16_t oled_coord_t;
+
+
+//! @brief Called from the refresh task when a swapped buffer has been sent to the panel
+typedef void (*oled_refresh_cb_t)(uint8_t id, void *arg);
+
+
 //! @brief Drawing color
 typedef enum
 {
@@ -38,18 +61,58 @@ typedef enum
 } oled_color_t;
 
 
+//! @brief Bitmap memory layout
+typedef enum
+{
+    OLED_BITMAP_PAGE = 0,   //!< Like display RAM: each byte holds 8 rows of one column (LSB on top), columns
+                            //!< left to right, then the next 8 rows. Fastest.
+    OLED_BITMAP_ROW = 1,    //!< Each row padded to whole bytes with the leftmost pixel in the MSB, rows top
+                            //!< to bottom, as most image converters output
+} oled_bitmap_format_t;
+
+
+//! @brief Raster operation combining bitmap with the panel
+typedef enum
+{
+    OLED_ROP_COPY = 0,      //!< Replace panel pixels with bitmap
+    OLED_ROP_OR = 1,        //!< Set pixels set in bitmap
+    OLED_ROP_AND = 2,       //!< Clear pixels clear in bitmap
+    OLED_ROP_XOR = 3,       //!< Invert pixels set in bitmap
+    OLED_ROP_MASKED = 4,    //!< Replace panel pixels with bitmap where mask is set, leave the rest
+} oled_rop_t;
+
+
+/**
+ * @brief   Return number of panel IDs
+ * @return  Number of entries in the panel table (OLED_PANELS in oled_i2c.c), IDs run from 0
+ * @remark  Other functions treat an ID past the table like a panel that is not initialized
+ */
+uint8_t oled_get_panel_count(void);
+
+
 /**
  * @brief   Initialize OLED panel
- * @param   id  Panel ID (0 or 1)
+ * @param   id  Panel ID
  * @return  true if successful
  * @remark  Possible reasons for failure include non-configured panel type, out of memory or I2C not responding
  */
 bool oled_init(uint8_t id);
 
 
+/**
+ * @brief   Initialize OLED panel, drawing into a display buffer supplied by the caller
+ * @param   id      Panel ID
+ * @param   buffer  Display buffer of width * height / 8 bytes, 4-byte aligned. Must stay valid until
+ *                  #oled_term. NULL for the panel's slice of the static arena (OLED_ARENA_SIZE in
+ *                  oled_i2c.c), or heap if there is no arena.
+ * @return  true if successful
+ */
+bool oled_init_buffer(uint8_t id, uint8_t *buffer);
+
+
 /**
  * @brief   De-initialize OLED panel, turn off power and free memory
- * @param   id  Panel ID (0 or 1)
+ * @param   id  Panel ID
  * @return  true if successful
  * @remark  Possible reasons for failure include non-configured panel type, out of memory or I2C not responding
  */
@@ -58,124 +121,372 @@ void oled_term(uint8_t id);
 
 /**
  * @brief   Return OLED panel width
- * @param   id  Panel ID (0 or 1)
- * @return  Panel width, or return 0 if failed (panel not initialized)
+ * @param   id  Panel ID
+ * @return  Panel width, or return 0 if failed (panel not initialized or ID out of range)
  */
 uint8_t oled_get_width(uint8_t id);
 
 
 /**
  * @brief   Return OLED panel height
- * @param   id  Panel ID (0 or 1)
- * @return  Panel height, or return 0 if failed (panel not initialized)
+ * @param   id  Panel ID
+ * @return  Panel height, or return 0 if failed (panel not initialized or ID out of range)
  */
 uint8_t oled_get_height(uint8_t id);
 
 /**
  * @brief   Clear display buffer (fill with black)
- * @param   id Panel ID (0 or 1)
+ * @param   id Panel ID
  */
 void oled_clear(uint8_t id);
 
 /**
  * @brief   Refresh display (send display buffer to the panel)
- * @param   id      Panel ID (0 or 1)
+ * @param   id      Panel ID
  * @param   force   The program automatically tracks "dirty" region to minimize refresh area. Set #force to true
  *                  ignores the dirty region and refresh the whole screen.
  */
 void oled_refresh(uint8_t id, bool force);
 
+/**
+ * @brief   Refresh panels 0 and 1 at the same time. Needs the panels on different I2C SDA lanes
+ *          (OLED_PANELS in oled_i2c.c), otherwise same as calling #oled_refresh for each.
+ * @param   force   Refresh whole screens
+ * @remark  Each panel is sent as one window bounding its dirty pages, OLED_REFRESH_BURST and diff
+ *          refresh do not apply. Falls back to #oled_refresh if double buffering is enabled.
+ */
+void oled_refresh_dual(bool force);
+
+/**
+ * @brief   Return I2C bus cost of the last refresh
+ * @param   id      Panel ID
+ * @return  Number of I2C bit times (START, STOP, data and ACK bits) spent by the last refresh
+ */
+uint32_t oled_get_refresh_bits(uint8_t id);
+
+/**
+ * @brief   Enable or disable diff refresh. When enabled, the driver keeps a copy of the frame last sent
+ *          to the panel and refresh only sends bytes that changed.
+ * @param   id      Panel ID
+ * @param   enable  Enable diff refresh
+ * @return  true if successful, false if panel not initialized or out of memory
+ */
+bool oled_set_diff_refresh(uint8_t id, bool enable);
+
+/**
+ * @brief   Get diff refresh statistics of the last refresh
+ * @param   id      Panel ID
+ * @param   stats   Statistics output
+ * @return  true if successful, false if diff refresh is not enabled
+ */
+bool oled_get_diff_stats(uint8_t id, oled_diff_stats_t *stats);
+
+/**
+ * @brief   Enable or disable double buffering. When enabled, drawing goes to a back buffer and
+ *          #oled_swap hands it to a background task for sending, so the caller does not wait for I2C.
+ * @param   id      Panel ID
+ * @param   enable  Enable double buffering
+ * @param   cb      Called from the refresh task after each swapped buffer is sent, can be NULL
+ * @param   arg     Argument passed to #cb
+ * @return  true if successful
+ * @remark  Needs a second display buffer. #oled_refresh still works and blocks until the panel is updated.
+ */
+bool oled_set_double_buffer(uint8_t id, bool enable, oled_refresh_cb_t cb, void *arg);
+
+/**
+ * @brief   Queue drawn frame for refresh and return. Only blocks if the previous frame is still being sent.
+ *          Falls back to #oled_refresh if double buffering is not enabled.
+ * @param   id      Panel ID
+ * @param   force   Refresh the whole screen
+ */
+void oled_swap(uint8_t id, bool force);
+
+/**
+ * @brief   Wait until the last swapped frame is sent to the panel
+ * @param   id      Panel ID
+ */
+void oled_wait_refresh(uint8_t id);
+
+/**
+ * @brief   Enable or disable display list mode. In display list mode the panel has no display
+ *          buffer: drawing calls are recorded into a list of commands, and refresh renders the
+ *          list one page (8 rows) at a time into a shared scratch page, sending each page before
+ *          rendering the next. RAM per panel drops from the display buffer to the list size only
+ *          if the buffer came from heap (OLED_ARENA_SIZE 0 in oled_i2c.c and no caller buffer); an
+ *          arena slice or caller's buffer stays reserved for the panel.
+ * @param   id      Panel ID
+ * @param   enable  Enable display list mode
+ * @param   size    Display list size in bytes. Lines, rectangles and circles take 6 to 10 bytes, a
+ *                  character 9 bytes and a string 8 bytes plus its length.
+ * @return  true if successful, false if panel not initialized or out of memory
+ * @remark  Enabling starts from an empty (black) frame, and turns off double buffering and diff
+ *          refresh. #oled_clear empties the list; commands that do not fit are dropped until then.
+ *          Each refresh replays the whole list for every dirty page, so keep the list to what is on
+ *          screen and clear it when redrawing a frame. Disabling renders the list into the arena
+ *          slice or caller's buffer if the panel has one, otherwise into a newly allocated display
+ *          buffer. To change the size, disable first.
+ */
+bool oled_set_display_list(uint8_t id, bool enable, uint16_t size);
+
+/**
+ * @brief   Return bytes used in display list
+ * @param   id      Panel ID
+ * @return  Bytes recorded since last #oled_clear, 0 if not in display list mode
+ */
+uint16_t oled_get_display_list_len(uint8_t id);
+
+/**
+ * @brief   Enter a viewport. Drawing coordinates become relative to its top left corner, and
+ *          drawing is clipped to the part of it inside the current clip rectangle.
+ * @param   id      Panel ID
+ * @param   x       X coordinate of top left corner, in current drawing coordinates
+ * @param   y       Y coordinate of top left corner, in current drawing coordinates
+ * @param   w       Viewport width
+ * @param   h       Viewport height
+ * @return  false if OLED_VIEWPORT_DEPTH viewports are already entered
+ * @remark  #oled_clear still clears the whole panel, and sprites are placed on the panel.
+ */
+bool oled_push_viewport(uint8_t id, oled_coord_t x, oled_coord_t y, oled_coord_t w, oled_coord_t h);
+//! @brief Leave viewport, restoring the viewport and clip rectangle in effect before it was entered
+void oled_pop_viewport(uint8_t id);
+/**
+ * @brief   Clip drawing to a rectangle, in drawing coordinates. The clip rectangle is limited to the
+ *          current viewport and is restored by #oled_pop_viewport.
+ */
+void oled_set_clip(uint8_t id, oled_coord_t x, oled_coord_t y, oled_coord_t w, oled_coord_t h);
+//! @brief Clip drawing to the whole of the current viewport
+void oled_reset_clip(uint8_t id);
+
+/**
+ * @brief   Draw on a canvas larger than the panel, which shows a window of it. Moving the window
+ *          (panning, marquee) redraws nothing, the next refresh sends the new window.
+ * @param   id      Panel ID
+ * @param   width   Canvas width, at least the panel width
+ * @param   height  Canvas height, at least the panel height, rounded up to a multiple of 8
+ * @return  true if successful. The top left of the drawing is kept, the window returns to the top
+ *          left and the viewport stack is emptied. Not available in display list mode, with double
+ *          buffering or with OLED_FIXED_WIDTH set. Set the panel size to go back to a plain display
+ *          buffer.
+ * @remark  Drawing coordinates are canvas coordinates. Sprites are placed on the panel.
+ */
+bool oled_set_canvas(uint8_t id, uint16_t width, uint16_t height);
+//! @brief Move the window the panel shows to (x, y) of the canvas, kept inside the canvas
+void oled_set_window(uint8_t id, oled_coord_t x, oled_coord_t y);
+
+/**
+ * @brief   Draw into and refresh from a caller's buffer instead of the display buffer, no frame is
+ *          copied. The whole panel is refreshed once, then as usual only what is marked dirty.
+ * @param   id      Panel ID
+ * @param   buffer  Frame in display RAM layout (see OLED_BITMAP_PAGE), width * height / 8 bytes. Must
+ *                  stay valid until #oled_detach_buffer or #oled_term.
+ * @return  true if successful, false for a NULL buffer. Not available in display list or console
+ *          mode, with double buffering or canvas.
+ * @remark  Drawing functions paint into the attached buffer. After writing to it directly, mark what
+ *          changed with #oled_update_region and a NULL source.
+ */
+bool oled_attach_buffer(uint8_t id, uint8_t *buffer);
+//! @brief Go back to the display buffer, which takes over the frame of the attached buffer
+void oled_detach_buffer(uint8_t id);
+
+/**
+ * @brief   Copy a block in display RAM layout into the display buffer, and mark only the block dirty
+ * @param   id      Panel ID
+ * @param   x       First column
+ * @param   page    First page (8-row stripe)
+ * @param   w       Number of columns
+ * @param   pages   Number of pages
+ * @param   src     First byte of the block, NULL to only mark the block dirty (e.g. after writing
+ *                  into an attached buffer)
+ * @param   stride  Bytes from one page of src to the next
+ * @remark  The block is clipped to the display buffer. No effect in display list mode.
+ */
+void oled_update_region(uint8_t id, oled_coord_t x, uint8_t page, oled_coord_t w, uint8_t pages,
+                        const uint8_t *src, uint16_t stride);
+
 /**
  * @brief   Draw one pixel
- * @param   id      Panel ID (0 or 1)
+ * @param   id      Panel ID
  * @param   x       X coordinate
  * @param   y       Y coordinate
  * @param   color   Color of the pixel
  */
-void oled_draw_pixel(uint8_t id, int8_t x, int8_t y, oled_color_t color);
+void oled_draw_pixel(uint8_t id, oled_coord_t x, oled_coord_t y, oled_color_t color);
 
 
 /**
  * @brief   Draw horizontal line
- * @param   id      Panel ID (0 or 1)
+ * @param   id      Panel ID
  * @param   x       X coordinate or starting (left) point
  * @param   y       Y coordinate or starting (left) point
  * @param   w       Line width
  * @param   color   Color of the line
  */
-void oled_draw_hline(uint8_t id, int8_t x, int8_t y, uint8_t w, oled_color_t color);
+void oled_draw_hline(uint8_t id, oled_coord_t x, oled_coord_t y, oled_coord_t w, oled_color_t color);
 
 
 /**
  * @brief   Draw vertical line
- * @param   id      Panel ID (0 or 1)
+ * @param   id      Panel ID
  * @param   x       X coordinate or starting (top) point
  * @param   y       Y coordinate or starting (top) point
  * @param   h       Line height
  * @param   color   Color of the line
  */
-void oled_draw_vline(uint8_t id, int8_t x, int8_t y, uint8_t h, oled_color_t color);
+void oled_draw_vline(uint8_t id, oled_coord_t x, oled_coord_t y, oled_coord_t h, oled_color_t color);
+
+/**
+ * @brief   Draw a line between two points, both ends included. The line is clipped to the clip rectangle.
+ * @param   id      Panel ID
+ * @param   x0      X coordinate of first point
+ * @param   y0      Y coordinate of first point
+ * @param   x1      X coordinate of second point
+ * @param   y1      Y coordinate of second point
+ * @param   color   Color of the line
+ */
+void oled_draw_line(uint8_t id, oled_coord_t x0, oled_coord_t y0, oled_coord_t x1, oled_coord_t y1, oled_color_t color);
 
 /**
  * @brief   Draw a rectangle
- * @param   id      Panel ID (0 or 1)
+ * @param   id      Panel ID
  * @param   x       X coordinate or starting (top left) point
  * @param   y       Y coordinate or starting (top left) point
  * @param   w       Rectangle width
  * @param   h       Rectangle height
  * @param   color   Color of the rectangle border
  */
-void oled_draw_rectangle(uint8_t id, int8_t x, int8_t y, uint8_t w, uint8_t h, oled_color_t color);
+void oled_draw_rectangle(uint8_t id, oled_coord_t x, oled_coord_t y, oled_coord_t w, oled_coord_t h, oled_color_t color);
 
 
 /**
  * @brief   Draw a filled rectangle
- * @param   id      Panel ID (0 or 1)
+ * @param   id      Panel ID
  * @param   x       X coordinate or starting (top left) point
  * @param   y       Y coordinate or starting (top left) point
  * @param   w       Rectangle width
  * @param   h       Rectangle height
  * @param   color   Color of the rectangle
  */
-void oled_fill_rectangle(uint8_t id, int8_t x, int8_t y, uint8_t w, uint8_t h, oled_color_t color);
+void oled_fill_rectangle(uint8_t id, oled_coord_t x, oled_coord_t y, oled_coord_t w, oled_coord_t h, oled_color_t color);
 
 
 /**
  * @brief   Draw a circle
- * @param   id      Panel ID (0 or 1)
+ * @param   id      Panel ID
  * @param   x0      X coordinate or center
  * @param   y0      Y coordinate or center
  * @param   r       Radius
  * @param   color   Color of the circle
  */
-void oled_draw_circle(uint8_t id, int8_t x0, int8_t y0, uint8_t r, oled_color_t color);
+void oled_draw_circle(uint8_t id, oled_coord_t x0, oled_coord_t y0, oled_coord_t r, oled_color_t color);
 
 /**
  * @brief   Draw a filled circle
- * @param   id      Panel ID (0 or 1)
+ * @param   id      Panel ID
  * @param   x0      X coordinate or center
  * @param   y0      Y coordinate or center
  * @param   r       Radius
  * @param   color   Color of the circle
  */
-void oled_fill_circle(uint8_t id, int8_t x0, int8_t y0, uint8_t r, oled_color_t color);
+void oled_fill_circle(uint8_t id, oled_coord_t x0, oled_coord_t y0, oled_coord_t r, oled_color_t color);
+
+
 
+/**
+ * @brief   Draw a 1bpp bitmap. The bitmap may hang over any edge of the panel and is clipped.
+ * @param   id      Panel ID
+ * @param   x       X coordinate of top left corner, can be negative
+ * @param   y       Y coordinate of top left corner, can be negative
+ * @param   bitmap  Bitmap
+ * @param   mask    Pixels to replace for #OLED_ROP_MASKED, same size and format as bitmap. Ignored by
+ *                  other operations, NULL replaces all pixels
+ * @param   w       Bitmap width
+ * @param   h       Bitmap height
+ * @param   format  Bitmap layout
+ * @param   rop     How bitmap pixels combine with panel pixels
+ * @remark  In display list mode only the pointers are recorded, bitmap and mask must stay valid (e.g.
+ *          const data) until the list is cleared.
+ */
+void oled_draw_bitmap(uint8_t id, oled_coord_t x, oled_coord_t y, const uint8_t *bitmap, const uint8_t *mask,
+                      uint8_t w, uint8_t h, oled_bitmap_format_t format, oled_rop_t rop);
 
+/**
+ * @brief   Enable or disable sprites. With sprites the display buffer is the background, sprites are
+ *          drawn over it at refresh and only the areas they enter or leave are sent to the panel.
+ * @param   id      Panel ID
+ * @param   enable  true to enable sprites, false to remove all sprites
+ * @return  true if successful. Needs a second display buffer; not available in display list mode or
+ *          with double buffering
+ */
+bool oled_set_sprites(uint8_t id, bool enable);
+/**
+ * @brief   Add a visible sprite
+ * @param   id      Panel ID
+ * @param   x       X coordinate of top left corner, can be negative
+ * @param   y       Y coordinate of top left corner, can be negative
+ * @param   bitmap  Page format bitmap, must stay valid while the sprite uses it
+ * @param   mask    Sprite pixels of bitmap, same size and format. NULL for a rectangular sprite
+ * @param   w       Sprite width
+ * @param   h       Sprite height
+ * @param   z       Stacking order, higher z is drawn on top. Equal z draws later sprites on top
+ * @return  Sprite handle, -1 if sprites are disabled or all OLED_MAX_SPRITES are in use
+ */
+int8_t oled_sprite_add(uint8_t id, oled_coord_t x, oled_coord_t y, const uint8_t *bitmap, const uint8_t *mask,
+                       uint8_t w, uint8_t h, uint8_t z);
+//! @brief Remove sprite, its handle may be reused by oled_sprite_add()
+void oled_sprite_remove(uint8_t id, int8_t sprite);
+//! @brief Move sprite to new top left corner
+void oled_sprite_move(uint8_t id, int8_t sprite, oled_coord_t x, oled_coord_t y);
+//! @brief Show or hide sprite
+void oled_sprite_show(uint8_t id, int8_t sprite, bool visible);
+//! @brief Change sprite image, e.g. next animation frame of the same size
+void oled_sprite_set_bitmap(uint8_t id, int8_t sprite, const uint8_t *bitmap, const uint8_t *mask);
 
 //! @fn
 void oled_select_font(uint8_t id, uint8_t idx);
+/**
+ * @brief   Draw one character, space if it is not in the font
+ * @param   c   Unicode code point, or byte of an 8-bit font such as glcd 5x7
+ * @return  Character width
+ */
+uint8_t oled_draw_char(uint8_t id, oled_coord_t x, oled_coord_t y, uint16_t c, oled_color_t foreground, oled_color_t background);
+/**
+ * @brief   Draw UTF-8 string. Bytes that do not form valid UTF-8 are drawn as single characters.
+ * @return  String width
+ */
+uint16_t oled_draw_string(uint8_t id, oled_coord_t x, oled_coord_t y, char *str, oled_color_t foreground, oled_color_t background);
 //! @fn
-uint8_t oled_draw_char(uint8_t id, uint8_t x, uint8_t y, char c, oled_color_t foreground, oled_color_t background);
-//! @fn
-uint8_t oled_draw_string(uint8_t id, uint8_t x, uint8_t y, char *str, oled_color_t foreground, oled_color_t background);
-//! @fn
-uint8_t oled_measure_string(uint8_t id, char *str);
+uint16_t oled_measure_string(uint8_t id, char *str);
 //! @fn
 uint8_t oled_get_font_height(uint8_t id);
 //! @fn
 uint8_t oled_get_font_c(uint8_t id);
 
-//! @fn
+/**
+ * @brief   Turn console mode on or off. Console mode treats display RAM as a ring of pages:
+ *          scrolling moves the display start line, and only the pages scrolled in are sent.
+ * @param   id      Panel ID
+ * @param   enable  true to clear the panel and start a console at top left
+ * @return  true if successful. Not available in display list mode, with double buffering,
+ *          sprites, canvas or attached buffer.
+ * @remark  Other drawing still works and scrolls along with the console text. Turning console
+ *          mode off resends the whole panel on the next refresh.
+ */
+bool oled_set_console(uint8_t id, bool enable);
+
+/**
+ * @brief   Write UTF-8 text at the console cursor with the current font, white on black. Lines
+ *          wrap at the panel edge, '\n' starts a new line and '\r' is ignored. Once the last
+ *          line is full the console scrolls by the font height rounded up to whole pages.
+ * @remark  Text appears on the next #oled_refresh. A one-line scroll of an 8-row font then costs
+ *          one page of data and the start line command instead of the whole frame. On panels as
+ *          tall as their display RAM (128x64, SH1107) the scroll shows before the new line is sent.
+ */
+void oled_console_write(uint8_t id, const char *str);
+
+//! @brief Scroll a console up by pages (8-row stripes), the pages scrolled in are cleared
+void oled_console_scroll(uint8_t id, uint8_t pages);
+
+//! @fn Hardware scrolling, not available on page mode (SH1107) panels or in console mode
 void oled_start_scroll_right(uint8_t id, uint8_t start, uint8_t stop);
 //! @fn
 void oled_start_scroll_left(uint8_t id, uint8_t start, uint8_t stop);
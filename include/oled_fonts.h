@@ -33,15 +33,28 @@ typedef struct _font_char_desc
 } font_char_desc_t;
 
 
+//! @brief Run of consecutive code points in a sparse font
+typedef struct _font_range
+{
+    uint16_t first;         //!< First code point
+    uint16_t last;          //!< Last code point
+    uint16_t index;         //!< Index of first code point in char_descriptors
+} font_range_t;
+
+
 //! @brief Font information
 typedef struct _font_info
 {
     uint8_t height;         //!< Character height in pixel, all characters have same height
     uint8_t c;              //!< Simulation of "C" width in TrueType term, the space between adjacent characters
-    char char_start;        //!< First character
-    char char_end;          //!< Last character
+    uint16_t char_start;    //!< First character, if ranges is NULL
+    uint16_t char_end;      //!< Last character, if ranges is NULL
     const font_char_desc_t* char_descriptors; //! descriptor for each character
-    const uint8_t *bitmap;  //!< Character bitmap
+    const uint8_t *bitmap;  //!< Character bitmaps, page-aligned like display RAM: each byte holds 8 rows of
+                            //!< one column (LSB on top), columns left to right, then the next 8 rows
+    const font_range_t *ranges; //!< Code point ranges sorted by first, searched for each character. NULL
+                                //!< if the font covers char_start to char_end without gaps
+    uint16_t range_count;   //!< Number of ranges
 } font_info_t;
 
 
@@ -0,0 +1,606 @@
+/**
+  ******************************************************************************
+  * @file    fontc.cpp
+  * @author  Baoshi <mail(at)ba0sh1(dot)com>
+  * @version 0.1
+  * @date    Dec 24, 2014
+  * @brief   Font compiler. Reads a BDF bitmap font and writes the glyph tables
+  *          (bitmap, descriptors and font_info_t) used by the display drivers,
+  *          page-aligned like display RAM (oled_fonts.h). Row-major tables
+  *          are kept for drivers outside this tree, nothing here reads them.
+  *          PCF fonts can be turned into BDF with pcf2bdf.
+  *
+  *          Build with "make fontc" in this directory, "make fonts"
+  *          regenerates the tables in ../user from the sources in fonts/.
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Copyright (c) 2015, Baoshi Zhu. All rights reserved.
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+//! @brief Glyph rendered into a cell of font height, one byte per pixel
+struct Glyph
+{
+    int width = 0;
+    std::vector<uint8_t> pixels;    // height rows of width pixels
+};
+
+struct Font
+{
+    int ascent = 0;
+    int descent = 0;
+    int default_char = -1;
+    std::string name;               // FONT line
+    std::map<int, Glyph> glyphs;    // By encoding
+
+    int height() const { return ascent + descent; }
+};
+
+enum class Layout { Row, Page };
+
+struct Options
+{
+    std::string input;
+    std::string output;
+    std::string name;
+    std::string title;
+    std::string header;             // Empty for oled_fonts.h, which only page layout matches
+    Layout layout = Layout::Page;
+    std::vector<std::pair<int, int>> ranges;    // Sorted, non-overlapping code point runs
+    int gap = 1;
+    bool dedup = false;
+    std::string command;            // Command line, echoed into output
+};
+
+
+static void usage()
+{
+    std::cerr <<
+        "usage: fontc [options] font.bdf\n"
+        "  -o file        output C file (default stdout)\n"
+        "  -n name        symbol prefix, e.g. tahoma_8pt (default from file name)\n"
+        "  -t title       font title used in comments (default symbol prefix)\n"
+        "  -r ranges      code points to include, e.g. 32-126,0xB0,0x2190-0x2193 (default all characters\n"
+        "                 in font). Row layout takes a single range within 0-255\n"
+        "  -l row|page    bitmap layout: page-aligned for oled_fonts.h (default), or row-major for a\n"
+        "                 driver outside this tree, which no code here reads. Row layout requires -i\n"
+        "  -i header      header declaring font_info_t (default oled_fonts.h with page layout)\n"
+        "  -c gap         space between adjacent characters, \"C\" of font_info_t (default 1)\n"
+        "  -d             store the bitmap of identical glyphs once\n";
+}
+
+
+static bool fail(const std::string &msg)
+{
+    std::cerr << "fontc: " << msg << "\n";
+    return false;
+}
+
+
+/**
+ * @brief   Read BDF font, placing every glyph in a cell of FONT_ASCENT + FONT_DESCENT rows with
+ *          the baseline FONT_ASCENT rows down. Glyph width is its ink extent right of the origin,
+ *          or the advance less the character gap for blank glyphs.
+ */
+static bool read_bdf(const std::string &path, int gap, Font &font)
+{
+    std::ifstream in(path);
+    std::string line, key;
+    int encoding = -1, dwidth = 0, bw = 0, bh = 0, bx = 0, by = 0, row = 0, lineno = 0;
+    bool in_bitmap = false;
+    Glyph g;
+
+    if (!in)
+        return fail("cannot open " + path);
+    while (std::getline(in, line))
+    {
+        ++lineno;
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        std::istringstream ls(line);
+        if (in_bitmap)
+        {
+            if (line == "ENDCHAR")
+            {
+                in_bitmap = false;
+                if (encoding >= 0)
+                    font.glyphs[encoding] = g;
+                continue;
+            }
+            // One hex row, MSB is the leftmost pixel
+            int y = font.ascent - by - bh + row++;
+            for (int x = 0; x < bw; ++x)
+            {
+                size_t digit = x / 4;
+                if (digit >= line.size())
+                    break;
+                int nibble = std::stoi(line.substr(digit, 1), nullptr, 16);
+                if (!(nibble & (8 >> (x % 4))))
+                    continue;
+                int px = bx + x;
+                if ((px < 0) || (px >= g.width) || (y < 0) || (y >= font.height()))
+                {
+                    std::cerr << "fontc: " << path << ":" << lineno << ": pixel outside cell dropped\n";
+                    continue;
+                }
+                g.pixels[y * g.width + px] = 1;
+            }
+            continue;
+        }
+        ls >> key;
+        if (key == "FONT")
+            std::getline(ls >> std::ws, font.name);
+        else if (key == "FONT_ASCENT")
+            ls >> font.ascent;
+        else if (key == "FONT_DESCENT")
+            ls >> font.descent;
+        else if (key == "DEFAULT_CHAR")
+            ls >> font.default_char;
+        else if (key == "STARTCHAR")
+        {
+            encoding = -1;
+            dwidth = bw = bh = bx = by = 0;
+        }
+        else if (key == "ENCODING")
+            ls >> encoding;
+        else if (key == "DWIDTH")
+            ls >> dwidth;
+        else if (key == "BBX")
+            ls >> bw >> bh >> bx >> by;
+        else if (key == "BITMAP")
+        {
+            if (font.height() <= 0)
+                return fail(path + ": FONT_ASCENT and FONT_DESCENT missing");
+            g = Glyph();
+            g.width = (bw > 0) ? bx + bw : dwidth - gap;
+            if (g.width < 0)
+                g.width = 0;
+            g.pixels.assign(g.width * font.height(), 0);
+            row = 0;
+            in_bitmap = true;
+        }
+    }
+    if (font.glyphs.empty())
+        return fail(path + ": no glyphs");
+    return true;
+}
+
+
+//! @brief Encode glyph in the requested layout
+static std::vector<uint8_t> encode(const Glyph &g, int height, Layout layout)
+{
+    std::vector<uint8_t> out;
+
+    if (layout == Layout::Row)
+    {
+        // Each row padded to whole bytes, MSB on the left
+        int bytes = (g.width + 7) / 8;
+        for (int y = 0; y < height; ++y)
+            for (int b = 0; b < bytes; ++b)
+            {
+                uint8_t v = 0;
+                for (int k = 0; k < 8; ++k)
+                    if ((b * 8 + k < g.width) && g.pixels[y * g.width + b * 8 + k])
+                        v |= 0x80 >> k;
+                out.push_back(v);
+            }
+    }
+    else
+    {
+        // Each byte 8 rows of a column, LSB on top, then the next 8 rows
+        for (int page = 0; page < (height + 7) / 8; ++page)
+            for (int x = 0; x < g.width; ++x)
+            {
+                uint8_t v = 0;
+                for (int k = 0; k < 8; ++k)
+                    if ((page * 8 + k < height) && g.pixels[(page * 8 + k) * g.width + x])
+                        v |= 1 << k;
+                out.push_back(v);
+            }
+    }
+    return out;
+}
+
+
+//! @brief Character as C character constant, or Unicode notation beyond 8 bits
+static std::string char_name(int c)
+{
+    char s[12];
+    if ((c >= 0x20) && (c < 0x7f) && (c != '\'') && (c != '\\'))
+        snprintf(s, sizeof(s), "'%c'", c);
+    else if (c <= 0xff)
+        snprintf(s, sizeof(s), "'\\x%X'", c);
+    else
+        snprintf(s, sizeof(s), "U+%04X", c);
+    return s;
+}
+
+
+/**
+ * @brief   Parse comma separated code points and first-last runs, then sort and merge them
+ * @return  false on syntax error
+ */
+static bool parse_ranges(const std::string &arg, std::vector<std::pair<int, int>> &ranges)
+{
+    std::istringstream in(arg);
+    std::string item;
+    std::vector<std::pair<int, int>> runs;
+
+    while (std::getline(in, item, ','))
+    {
+        int first, last;
+        char dash;
+        std::istringstream is(item);
+        if (!(is >> std::setbase(0) >> first))
+            return false;
+        last = first;
+        if ((is >> dash) && ((dash != '-') || !(is >> std::setbase(0) >> last)))
+            return false;
+        if ((first < 0) || (last > 0xffff) || (first > last))
+            return false;
+        runs.push_back(std::make_pair(first, last));
+    }
+    std::sort(runs.begin(), runs.end());
+    ranges.clear();
+    for (auto &r : runs)
+    {
+        if (!ranges.empty() && (r.first <= ranges.back().second + 1))
+            ranges.back().second = std::max(ranges.back().second, r.second);
+        else
+            ranges.push_back(r);
+    }
+    return !ranges.empty();
+}
+
+
+static std::string hex(uint8_t v)
+{
+    char s[8];
+    snprintf(s, sizeof(s), "0x%02X,", v);
+    return s;
+}
+
+
+static std::string hex16(int v)
+{
+    char s[8];
+    snprintf(s, sizeof(s), "0x%04X", v);
+    return s;
+}
+
+
+static std::string art(const Glyph &g, int y)
+{
+    std::string s = "    //";
+    if (g.width)
+        s += ' ';
+    for (int x = 0; x < g.width; ++x)
+        s += g.pixels[y * g.width + x] ? '#' : ' ';
+    while (s.back() == ' ')
+        s.pop_back();
+    return s;
+}
+
+
+static std::string base_name(const std::string &path)
+{
+    size_t slash = path.find_last_of('/');
+    return (slash == std::string::npos) ? path : path.substr(slash + 1);
+}
+
+
+static bool emit(const Options &opt, const Font &font)
+{
+    const int height = font.height();
+    const Glyph *blank = nullptr;
+    std::vector<int> codes;
+    std::vector<const Glyph *> glyphs;
+    std::vector<uint16_t> offsets;
+    std::map<std::pair<int, std::vector<uint8_t>>, uint16_t> stored;
+    std::ostringstream bm, desc;
+    size_t total = 0;
+    int shared = 0;
+
+    auto def = font.glyphs.find(font.default_char);
+    if (def == font.glyphs.end())
+        def = font.glyphs.find(' ');
+    if (def != font.glyphs.end())
+        blank = &def->second;
+
+    for (auto &r : opt.ranges)
+        for (int c = r.first; c <= r.second; ++c)
+            codes.push_back(c);
+    for (int c : codes)
+    {
+        auto it = font.glyphs.find(c);
+        if (it == font.glyphs.end())
+        {
+            if (blank == nullptr)
+                return fail("character " + std::to_string(c) + " missing and font has no default character");
+            std::cerr << "fontc: character " << c << " missing, using default character\n";
+            glyphs.push_back(blank);
+        }
+        else
+        {
+            glyphs.push_back(&it->second);
+        }
+    }
+
+    for (size_t i = 0; i < glyphs.size(); ++i)
+    {
+        const Glyph &g = *glyphs[i];
+        std::vector<uint8_t> data = encode(g, height, opt.layout);
+        auto key = std::make_pair(g.width, data);
+        if (opt.dedup && stored.count(key))
+        {
+            offsets.push_back(stored[key]);
+            ++shared;
+            continue;
+        }
+        if (total + data.size() > 0xffff)
+            return fail("bitmap exceeds 64kB");
+        offsets.push_back((uint16_t)total);
+        stored[key] = (uint16_t)total;
+
+        if (total)
+            bm << "\n";
+        bm << "    /* @" << total << " " << char_name(codes[i]) << " (" << g.width << " pixels wide) */\n";
+        if (opt.layout == Layout::Row)
+        {
+            int bytes = (g.width + 7) / 8;
+            for (int y = 0; y < height; ++y)
+            {
+                std::string line = "    ";
+                for (int b = 0; b < bytes; ++b)
+                    line += hex(data[y * bytes + b]) + " ";
+                line += art(g, y).substr(4);
+                bm << line << "\n";
+            }
+        }
+        else
+        {
+            for (int y = 0; y < height; ++y)
+                bm << art(g, y) << "\n";
+            for (int page = 0; page < (height + 7) / 8; ++page)
+            {
+                if (!g.width)
+                    continue;
+                std::string line = "   ";
+                for (int x = 0; x < g.width; ++x)
+                    line += " " + hex(data[page * g.width + x]);
+                bm << line << "\n";
+            }
+        }
+        total += data.size();
+    }
+
+    for (size_t i = 0; i < glyphs.size(); ++i)
+    {
+        std::string d = "    {" + std::to_string(glyphs[i]->width) + ", " + std::to_string(offsets[i]) + "},";
+        d.resize(18, ' ');
+        desc << d << "/* " << char_name(codes[i]) << " */\n";
+    }
+
+    std::ofstream file;
+    if (!opt.output.empty())
+    {
+        file.open(opt.output);
+        if (!file)
+            return fail("cannot write " + opt.output);
+    }
+    std::ostream &out = opt.output.empty() ? std::cout : file;
+    const bool sparse = (opt.ranges.size() > 1);
+    const int first = opt.ranges.front().first;
+    const int last = opt.ranges.back().second;
+    const char *layout = (opt.layout == Layout::Row)
+        ? "row-major: each row padded to whole bytes, MSB on the left"
+        : "page-aligned: each byte holds 8 rows of a column, LSB on top";
+
+    out << "/*\n"
+        << " * " << (opt.output.empty() ? opt.name + ".c" : base_name(opt.output)) << "\n"
+        << " *\n"
+        << " * Generated by tools/fontc from " << base_name(opt.input) << ", do not edit.\n"
+        << " *   " << opt.command << "\n"
+        << " */\n"
+        << "#include \"esp_common.h\"\n"
+        << "#include \"" << opt.header << "\"\n"
+        << "\n"
+        << "/*\n"
+        << "**  Font data for " << opt.title << "\n"
+        << "*/\n"
+        << "\n"
+        << "/* Character bitmaps for " << opt.title << ", " << layout << " */\n"
+        << "const uint8_t " << opt.name << "_bitmaps[] =\n"
+        << "{\n"
+        << bm.str()
+        << "};\n"
+        << "\n"
+        << "/* Character descriptors for " << opt.title << " */\n"
+        << "/* { [Char width in bits], [Offset into " << opt.name << "_bitmaps in bytes] } */\n"
+        << "const font_char_desc_t " << opt.name << "_descriptors[] =\n"
+        << "{\n"
+        << desc.str()
+        << "};\n"
+        << "\n";
+    if (sparse)
+    {
+        size_t index = 0;
+        out << "/* Character ranges for " << opt.title << " */\n"
+            << "/* { [First code point], [Last code point], [Index of first in " << opt.name << "_descriptors] } */\n"
+            << "const font_range_t " << opt.name << "_ranges[] =\n"
+            << "{\n";
+        for (auto &r : opt.ranges)
+        {
+            out << "    {" << hex16(r.first) << ", " << hex16(r.second) << ", " << index << "},"
+                << "  /* " << char_name(r.first) << " - " << char_name(r.second) << " */\n";
+            index += r.second - r.first + 1;
+        }
+        out << "};\n"
+            << "\n";
+    }
+    out << "/* Font information for " << opt.title << " */\n"
+        << "const font_info_t " << opt.name << "_font_info =\n"
+        << "{\n"
+        << "    " << height << ",  /* Character height */\n"
+        << "    " << opt.gap << ",  /* C */\n";
+    if (sparse)
+        out << "    0,  /* Start character, unused, see ranges */\n"
+            << "    0,  /* End character, unused, see ranges */\n";
+    else
+        out << "    " << first << ",  /* Start character " << char_name(first) << " */\n"
+            << "    " << last << ",  /* End character " << char_name(last) << " */\n";
+    out << "    " << opt.name << "_descriptors, /* Character descriptor array */\n"
+        << "    " << opt.name << "_bitmaps, /* Character bitmap array */\n";
+    if (opt.layout == Layout::Page)
+    {
+        if (sparse)
+            out << "    " << opt.name << "_ranges, /* Character ranges */\n"
+                << "    " << opt.ranges.size() << ",  /* Number of ranges */\n";
+        else
+            out << "    NULL, /* Character ranges, contiguous from start to end character */\n"
+                << "    0,  /* Number of ranges */\n";
+    }
+    out << "};\n";
+
+    std::cerr << "fontc: " << opt.name << ": " << glyphs.size() << " characters, " << total << " bitmap bytes";
+    if (opt.dedup)
+        std::cerr << ", " << shared << " shared";
+    std::cerr << "\n";
+    return true;
+}
+
+
+int main(int argc, char *argv[])
+{
+    Options opt;
+    Font font;
+    int i;
+
+    opt.command = "fontc";
+    for (i = 1; i < argc; ++i)
+    {
+        std::string a = argv[i];
+        opt.command += " " + ((a.find(' ') != std::string::npos) ? "\"" + a + "\"" : a);
+        if ((a.size() == 2) && (a[0] == '-') && strchr("onrlitc", a[1]))
+        {
+            if (++i >= argc)
+            {
+                usage();
+                return 1;
+            }
+            std::string v = argv[i];
+            opt.command += " " + ((v.find(' ') != std::string::npos) ? "\"" + v + "\"" : base_name(v));
+            switch (a[1])
+            {
+            case 'o': opt.output = v; break;
+            case 'n': opt.name = v; break;
+            case 't': opt.title = v; break;
+            case 'i': opt.header = v; break;
+            case 'c': opt.gap = atoi(v.c_str()); break;
+            case 'l':
+                if (v == "row")
+                    opt.layout = Layout::Row;
+                else if (v == "page")
+                    opt.layout = Layout::Page;
+                else
+                {
+                    usage();
+                    return 1;
+                }
+                break;
+            case 'r':
+                if (!parse_ranges(v, opt.ranges))
+                {
+                    usage();
+                    return 1;
+                }
+                break;
+            }
+        }
+        else if (a == "-d")
+        {
+            opt.dedup = true;
+        }
+        else if ((a[0] != '-') && opt.input.empty())
+        {
+            opt.input = a;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+    if (opt.input.empty())
+    {
+        usage();
+        return 1;
+    }
+    if (opt.name.empty())
+    {
+        opt.name = base_name(opt.input);
+        opt.name = opt.name.substr(0, opt.name.find('.'));
+    }
+    if (opt.title.empty())
+        opt.title = opt.name;
+    if (opt.header.empty())
+    {
+        // oled_i2c.c would draw row-major bitmaps as garbage
+        if (opt.layout == Layout::Row)
+        {
+            fail("row layout needs -i, oled_fonts.h takes page layout only");
+            return 1;
+        }
+        opt.header = "oled_fonts.h";
+    }
+
+    if (!read_bdf(opt.input, opt.gap, font))
+        return 1;
+    if (opt.ranges.empty())
+    {
+        // Every glyph in the font, split into runs of consecutive code points
+        for (auto &g : font.glyphs)
+        {
+            if (!opt.ranges.empty() && (g.first == opt.ranges.back().second + 1))
+                opt.ranges.back().second = g.first;
+            else
+                opt.ranges.push_back(std::make_pair(g.first, g.first));
+        }
+        if (opt.layout == Layout::Row)
+            opt.ranges = { std::make_pair(opt.ranges.front().first, opt.ranges.back().second) };
+    }
+    if ((opt.ranges.front().first < 0) || (opt.ranges.back().second > 0xffff))
+    {
+        fail("code points must be within 0-0xFFFF");
+        return 1;
+    }
+    if ((opt.layout == Layout::Row) && ((opt.ranges.size() > 1) || (opt.ranges.back().second > 255)))
+    {
+        fail("row layout takes a single character range within 0-255");
+        return 1;
+    }
+    return emit(opt, font) ? 0 : 1;
+}
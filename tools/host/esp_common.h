@@ -0,0 +1,88 @@
+/**
+  ******************************************************************************
+  * @file    esp_common.h
+  * @author  Baoshi <mail(at)ba0sh1(dot)com>
+  * @version 0.1
+  * @date    Dec 24, 2014
+  * @brief   Host stand-in for the SDK header, just enough to build i2c.c and
+  *          oled_i2c.c on a PC. GPIO and FRC1 register accesses go to the
+  *          model in the host program (see i2c_async_sim.c).
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Copyright (c) 2015, Baoshi Zhu. All rights reserved.
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#ifndef ESP_COMMON_H_
+#define ESP_COMMON_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ICACHE_FLASH_ATTR
+#define LOCAL static
+
+#define BIT(n)  (1UL << (n))
+#define BIT4    BIT(4)
+#define BIT5    BIT(5)
+#define BIT6    BIT(6)
+#define BIT7    BIT(7)
+#define BIT13   BIT(13)
+
+#define GPIO_OUT_ADDRESS         0x00
+#define GPIO_OUT_W1TS_ADDRESS    0x04
+#define GPIO_OUT_W1TC_ADDRESS    0x08
+#define GPIO_ENABLE_ADDRESS      0x0c
+#define GPIO_IN_ADDRESS          0x18
+#define GPIO_PIN0_ADDRESS        0x28
+#define GPIO_ID_PIN(n)           (n)
+#define GPIO_PIN_PAD_DRIVER_SET(x) ((x) << 2)
+#define GPIO_PAD_DRIVER_ENABLE   1
+
+#define PERIPHS_IO_MUX_GPIO4_U   0
+#define PERIPHS_IO_MUX_GPIO5_U   0
+#define PERIPHS_IO_MUX_MTCK_U    0
+#define PERIPHS_IO_MUX_MTDI_U    0
+#define FUNC_GPIO4               0
+#define FUNC_GPIO5               0
+#define FUNC_GPIO12              0
+#define FUNC_GPIO13              0
+#define PIN_FUNC_SELECT(mux, func) ((void)0)
+
+#define FRC1_LOAD_ADDRESS        0x100
+#define FRC1_CTRL_ADDRESS        0x108
+#define FRC1_INT_ADDRESS         0x10c
+#define FRC1_INT_CLR_MASK        0x01
+#define ETS_FRC_TIMER1_INUM      9
+#define TM1_EDGE_INT_ENABLE()    ((void)0)
+
+// Implemented by the host program
+void host_gpio_write(uint32_t addr, uint32_t val);
+uint32_t host_gpio_read(uint32_t addr);
+void host_timer_write(uint32_t addr, uint32_t val);
+void host_isr_attach(void (*isr)(void *), void *arg);
+void host_isr_mask(bool masked);
+uint8_t system_get_cpu_freq(void);
+
+#define GPIO_REG_WRITE(addr, val)    host_gpio_write((addr), (val))
+#define GPIO_REG_READ(addr)          host_gpio_read(addr)
+#define RTC_REG_WRITE(addr, val)     host_timer_write((addr), (val))
+#define RTC_CLR_REG_MASK(addr, mask) ((void)0)
+#define _xt_isr_attach(i, isr, arg)  host_isr_attach((isr), (arg))
+#define _xt_isr_mask(m)              host_isr_mask(true)
+#define _xt_isr_unmask(m)            host_isr_mask(false)
+
+#define zalloc(size)                 calloc(1, (size))
+#define os_delay_us(us)              ((void)(us))
+
+#endif
@@ -0,0 +1,97 @@
+/**
+  ******************************************************************************
+  * @file    FreeRTOS.h
+  * @author  Baoshi <mail(at)ba0sh1(dot)com>
+  * @version 0.1
+  * @date    Dec 24, 2014
+  * @brief   Host stand-in for the RTOS headers, just enough to build oled_i2c.c
+  *          on a PC. There is a single thread: queues and semaphores never
+  *          block, and tasks cannot be created, so features that need a task
+  *          (double buffering, bus manager) report failure.
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Copyright (c) 2015, Baoshi Zhu. All rights reserved.
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef long portBASE_TYPE;
+typedef unsigned long portTickType;
+
+#define pdFALSE             0
+#define pdTRUE              1
+#define pdFAIL              0
+#define pdPASS              1
+#define portMAX_DELAY       ((portTickType)0xffffffffUL)
+#define tskIDLE_PRIORITY    0
+
+//! @brief Queue of fixed size items, a semaphore is a queue of one item
+typedef struct _host_queue
+{
+    unsigned long length;   // Capacity in items
+    unsigned long size;     // Item size
+    unsigned long count;    // Items in queue
+    unsigned long head;     // Index of oldest item
+    uint8_t *items;
+} host_queue;
+
+typedef host_queue *xQueueHandle;
+
+
+static inline xQueueHandle xQueueCreate(unsigned long length, unsigned long size)
+{
+    host_queue *q = (host_queue *)calloc(1, sizeof(host_queue) + length * size);
+
+    if (q)
+    {
+        q->length = length;
+        q->size = size;
+        q->items = (uint8_t *)(q + 1);
+    }
+    return q;
+}
+
+
+static inline void vQueueDelete(xQueueHandle q)
+{
+    free(q);
+}
+
+
+//! @brief Append item, nothing can make room while waiting so a full queue fails at once
+static inline portBASE_TYPE xQueueSend(xQueueHandle q, const void *item, portTickType wait)
+{
+    if (q->count == q->length)
+        return pdFALSE;
+    memcpy(q->items + ((q->head + q->count) % q->length) * q->size, item, q->size);
+    ++q->count;
+    return pdTRUE;
+}
+
+
+//! @brief Take oldest item, nothing can send while waiting so an empty queue fails at once
+static inline portBASE_TYPE xQueueReceive(xQueueHandle q, void *item, portTickType wait)
+{
+    if (q->count == 0)
+        return pdFALSE;
+    memcpy(item, q->items + q->head * q->size, q->size);
+    q->head = (q->head + 1) % q->length;
+    --q->count;
+    return pdTRUE;
+}
+
+#endif
@@ -0,0 +1,38 @@
+/**
+  ******************************************************************************
+  * @file    semphr.h
+  * @author  Baoshi <mail(at)ba0sh1(dot)com>
+  * @version 0.1
+  * @date    Dec 24, 2014
+  * @brief   Host stand-in for the RTOS semaphores, binary semaphores built on
+  *          the queues of FreeRTOS.h.
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Copyright (c) 2015, Baoshi Zhu. All rights reserved.
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#ifndef SEMPHR_H_
+#define SEMPHR_H_
+
+#include "FreeRTOS.h"
+
+typedef xQueueHandle xSemaphoreHandle;
+
+static uint8_t host_sem_token;  // One-byte item that stands for the semaphore being given
+
+//! @brief Create binary semaphore, given like the SDK's
+#define vSemaphoreCreateBinary(s)   do { (s) = xQueueCreate(1, 1); if (s) xQueueSend((s), &host_sem_token, 0); } while (0)
+#define vSemaphoreDelete(s)         vQueueDelete(s)
+#define xSemaphoreTake(s, wait)     xQueueReceive((s), &host_sem_token, (wait))
+#define xSemaphoreGive(s)           xQueueSend((s), &host_sem_token, 0)
+
+#endif
@@ -0,0 +1,35 @@
+/**
+  ******************************************************************************
+  * @file    task.h
+  * @author  Baoshi <mail(at)ba0sh1(dot)com>
+  * @version 0.1
+  * @date    Dec 24, 2014
+  * @brief   Host stand-in for the RTOS tasks. The host program is the only
+  *          thread, creating a task always fails.
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Copyright (c) 2015, Baoshi Zhu. All rights reserved.
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#ifndef TASK_H_
+#define TASK_H_
+
+#include "FreeRTOS.h"
+
+typedef void *xTaskHandle;
+typedef void (*pdTASK_CODE)(void *pvParameters);
+
+#define xTaskCreate(fn, name, stack, arg, prio, handle)  ((void)(fn), (void)(arg), (portBASE_TYPE)pdFAIL)
+#define vTaskDelete(handle)                             ((void)(handle))
+#define vTaskDelay(ticks)                               ((void)(ticks))
+
+#endif
@@ -0,0 +1,325 @@
+/**
+  ******************************************************************************
+  * @file    i2c_async_sim.c
+  * @author  Baoshi <mail(at)ba0sh1(dot)com>
+  * @version 0.1
+  * @date    Dec 24, 2014
+  * @brief   Host stand-in for the asynchronous I2C engine. Builds the real i2c.c
+  *          against host/esp_common.h, fires its FRC1 interrupt from a simulated
+  *          timer, and answers on the bus with a 24C02-like EEPROM model.
+  *
+  *          Build and run with "make check" in this directory.
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Copyright (c) 2015, Baoshi Zhu. All rights reserved.
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#include <stdio.h>
+#include "esp_common.h"
+#include "i2c.h"
+
+
+#define SDA_PIN 5
+#define SCL_PIN 4
+#define EEPROM_ADDR 0xa0
+#define CPU_MHZ 80
+#define FRC1_CYCLES_PER_TICK (CPU_MHZ / 5)  // FRC1 runs at 80MHz / 16
+
+
+/*
+ * CPU cycle counter. Every read costs a few cycles, and a timer tick moves it forward by the
+ * timer period.
+ */
+static uint32_t _ccount;
+
+uint32_t i2c_ccount(void)
+{
+    _ccount += 3;
+    return _ccount;
+}
+
+
+uint8_t system_get_cpu_freq(void)
+{
+    return CPU_MHZ;
+}
+
+
+// Debug output of i2c.c goes to stdout
+void dmsg_puts(const char *s)
+{
+    fputs(s, stdout);
+}
+
+
+/*
+ * Simulated FRC1
+ */
+static uint32_t _timer_load, _timer_ctrl;
+static void (*_isr)(void *) = NULL;
+static void *_isr_arg;
+static bool _isr_masked;
+static uint32_t _isr_calls, _isr_cycles_max;
+
+void host_timer_write(uint32_t addr, uint32_t val)
+{
+    if (addr == FRC1_LOAD_ADDRESS)
+        _timer_load = val;
+    else if (addr == FRC1_CTRL_ADDRESS)
+        _timer_ctrl = val;
+}
+
+
+void host_isr_attach(void (*isr)(void *), void *arg)
+{
+    _isr = isr;
+    _isr_arg = arg;
+}
+
+
+void host_isr_mask(bool masked)
+{
+    _isr_masked = masked;
+}
+
+
+static bool _timer_armed(void)
+{
+    return (_timer_ctrl & BIT7) != 0;
+}
+
+
+//! @brief Let one timer period pass and run the interrupt
+static void _timer_tick(void)
+{
+    uint32_t start;
+
+    _ccount += _timer_load * FRC1_CYCLES_PER_TICK;
+    if (_isr_masked || !_isr)
+        return;
+    start = _ccount;
+    _isr(_isr_arg);
+    ++_isr_calls;
+    if (_ccount - start > _isr_cycles_max)
+        _isr_cycles_max = _ccount - start;
+}
+
+
+/*
+ * Bus with one EEPROM slave. The slave reacts to every GPIO write.
+ */
+static uint32_t _latch = 0xffffffff;
+static bool _slave_pull;        // Slave holds SDA low
+static bool _scl = true, _sda = true;
+
+enum { SLAVE_IDLE, SLAVE_ADDR, SLAVE_DATA };
+static uint8_t _slave_state = SLAVE_IDLE;
+static uint8_t _slave_bit, _slave_byte;
+static bool _slave_clocked;     // SCL has risen since START
+static bool _slave_tx, _slave_first, _slave_master_ack, _slave_have_ptr;
+static uint8_t _eeprom[256], _eeprom_ptr;
+static uint32_t _starts, _stops;
+
+
+static void _slave_drive(void)
+{
+    _slave_pull = !((_slave_byte >> (7 - _slave_bit)) & 0x01);
+}
+
+
+static void _slave_update(void)
+{
+    bool scl = (_latch >> SCL_PIN) & 0x01;
+    bool sda = ((_latch >> SDA_PIN) & 0x01) && !_slave_pull;
+
+    if (scl && _scl && (sda != _sda))
+    {
+        if (!sda)
+        {
+            // START or repeated START
+            ++_starts;
+            _slave_state = SLAVE_ADDR;
+            _slave_bit = 0;
+            _slave_byte = 0;
+            _slave_tx = false;
+            _slave_clocked = false;
+        }
+        else
+        {
+            ++_stops;
+            _slave_state = SLAVE_IDLE;
+        }
+        _slave_pull = false;
+    }
+    else if (scl && !_scl && (_slave_state != SLAVE_IDLE))
+    {
+        // Rising SCL, sample
+        _slave_clocked = true;
+        if ((_slave_bit < 8) && !_slave_tx)
+            _slave_byte = (_slave_byte << 1) | sda;
+        else if ((_slave_bit == 8) && _slave_tx)
+            _slave_master_ack = !sda;
+    }
+    else if (!scl && _scl && _slave_clocked && (_slave_state != SLAVE_IDLE))
+    {
+        // Falling SCL, drive
+        if (_slave_bit < 8)
+        {
+            if (++_slave_bit < 8)
+            {
+                if (_slave_tx)
+                    _slave_drive();
+            }
+            else if (_slave_tx)
+            {
+                _slave_pull = false;    // Master ACKs
+            }
+            else if (_slave_state == SLAVE_ADDR)
+            {
+                if ((_slave_byte & 0xfe) == EEPROM_ADDR)
+                {
+                    _slave_pull = true;
+                    _slave_tx = _slave_byte & 0x01;
+                    _slave_first = true;
+                    _slave_have_ptr = false;
+                    _slave_state = SLAVE_DATA;
+                }
+                else
+                {
+                    _slave_state = SLAVE_IDLE;
+                }
+            }
+            else
+            {
+                if (_slave_have_ptr)
+                    _eeprom[_eeprom_ptr++] = _slave_byte;
+                else
+                    _eeprom_ptr = _slave_byte;
+                _slave_have_ptr = true;
+                _slave_pull = true;
+            }
+        }
+        else
+        {
+            // End of ACK slot
+            _slave_bit = 0;
+            _slave_byte = 0;
+            _slave_pull = false;
+            if (_slave_tx)
+            {
+                if (_slave_first || _slave_master_ack)
+                {
+                    _slave_byte = _eeprom[_eeprom_ptr++];
+                    _slave_drive();
+                }
+                else
+                {
+                    _slave_state = SLAVE_IDLE;
+                }
+                _slave_first = false;
+            }
+        }
+    }
+    _scl = scl;
+    _sda = ((_latch >> SDA_PIN) & 0x01) && !_slave_pull;
+}
+
+
+void host_gpio_write(uint32_t addr, uint32_t val)
+{
+    if (addr == GPIO_OUT_W1TS_ADDRESS)
+        _latch |= val;
+    else if (addr == GPIO_OUT_W1TC_ADDRESS)
+        _latch &= ~val;
+    else if (addr == GPIO_OUT_ADDRESS)
+        _latch = val;
+    else
+        return;
+    _slave_update();
+}
+
+
+uint32_t host_gpio_read(uint32_t addr)
+{
+    if (addr == GPIO_IN_ADDRESS)
+        return _slave_pull ? (_latch & ~BIT(SDA_PIN)) : _latch;
+    return 0;
+}
+
+
+/*
+ * Test transactions
+ */
+static int _completed;
+static i2c_async_xfer_t *_order[8];
+
+static void _done(i2c_async_xfer_t *xfer, void *arg)
+{
+    _order[_completed++] = xfer;
+}
+
+
+static int _expect(const char *what, bool ok)
+{
+    printf("  %-44s %s\n", what, ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+
+int main(void)
+{
+    static const uint8_t page[] = { 0x10, 1, 2, 3, 4, 5, 6, 7, 8 };
+    static const uint8_t ptr[] = { 0x10 };
+    uint8_t rd[8], rd2[4];
+    i2c_async_xfer_t write = { NULL, EEPROM_ADDR, page, sizeof(page), NULL, 0, _done, NULL };
+    i2c_async_xfer_t absent = { NULL, 0x50, page, sizeof(page), NULL, 0, _done, NULL };
+    i2c_async_xfer_t readback = { NULL, EEPROM_ADDR, ptr, sizeof(ptr), rd, sizeof(rd), _done, NULL };
+    i2c_async_xfer_t readon = { NULL, EEPROM_ADDR, NULL, 0, rd2, sizeof(rd2), _done, NULL };
+    i2c_async_xfer_t probe = { NULL, EEPROM_ADDR, NULL, 0, NULL, 0, _done, NULL };
+    i2c_async_xfer_t noprobe = { NULL, 0x50, NULL, 0, NULL, 0, _done, NULL };
+    uint32_t ticks = 0;
+    int fail = 0;
+
+    memset(_eeprom, 0xee, sizeof(_eeprom));
+    i2c_init();
+
+    i2c_async_submit(&write);
+    i2c_async_submit(&absent);
+    i2c_async_submit(&readback);
+    i2c_async_submit(&readon);
+    i2c_async_submit(&probe);
+    i2c_async_submit(&noprobe);
+    while (_timer_armed() && (ticks < 100000))
+    {
+        _timer_tick();
+        ++ticks;
+    }
+
+    printf("%u timer ticks, %u interrupts, longest interrupt %u cycles, %u START %u STOP\n",
+        ticks, _isr_calls, _isr_cycles_max, _starts, _stops);
+    fail += _expect("timer stopped when queue ran dry", !_timer_armed() && !i2c_async_busy());
+    fail += _expect("callbacks in submission order", (_completed == 6) && (_order[0] == &write)
+        && (_order[1] == &absent) && (_order[2] == &readback) && (_order[3] == &readon)
+        && (_order[4] == &probe) && (_order[5] == &noprobe));
+    fail += _expect("write completed", (write.status == I2C_ASYNC_OK) && (write.done == sizeof(page)));
+    fail += _expect("EEPROM holds written page", memcmp(_eeprom + 0x10, page + 1, 8) == 0);
+    fail += _expect("absent slave NACK'ed", (absent.status == I2C_ASYNC_NACK) && (absent.done == 0));
+    fail += _expect("write-read completed", (readback.status == I2C_ASYNC_OK) && (readback.done == 1 + sizeof(rd)));
+    fail += _expect("read back matches", memcmp(rd, page + 1, 8) == 0);
+    fail += _expect("read-only continues from EEPROM pointer", (readon.status == I2C_ASYNC_OK)
+        && (readon.done == sizeof(rd2)) && (rd2[0] == 0xee));
+    fail += _expect("empty transaction probes the address", (probe.status == I2C_ASYNC_OK) && (probe.done == 0)
+        && (noprobe.status == I2C_ASYNC_NACK));
+    fail += _expect("START and STOP per transaction", (_starts == 7) && (_stops == 6));
+    printf("%s\n", fail ? "FAILED" : "OK");
+    return fail ? 1 : 0;
+}
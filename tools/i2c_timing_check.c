@@ -0,0 +1,272 @@
+/**
+  ******************************************************************************
+  * @file    i2c_timing_check.c
+  * @author  Baoshi <mail(at)ba0sh1(dot)com>
+  * @version 0.1
+  * @date    Dec 24, 2014
+  * @brief   Host check of the bit-bang I2C timing in i2c_timing.h. Converts every
+  *          speed mode at 80MHz and 160MHz CPU clock, then runs a cycle model of
+  *          the phase loop in i2c.c to confirm no bus phase comes out shorter than
+  *          the I2C specification allows and the clock stays close to nominal.
+  *
+  *          Build and run with "make check" in this directory.
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Copyright (c) 2015, Baoshi Zhu. All rights reserved.
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "i2c_timing.h"
+
+
+//! Cycles spent by one CCOUNT read plus loop branch in the wait loop
+#define MODEL_CCOUNT_CYCLES 3
+//! Cycles for a GPIO register write to reach the pin
+#define MODEL_EDGE_CYCLES 8
+//! Longest interrupt latency injected when interrupts are modelled
+#define MODEL_IRQ_CYCLES 400
+//! Lowest acceptable clock, as a fraction of nominal
+#define MODEL_MIN_RATIO 0.85
+
+
+static const char *_speed_names[] = { "standard", "fast", "fast+" };
+
+static uint32_t _now;           // Model cycle counter
+static uint32_t _edge;          // Same as _edge in i2c.c
+static bool _irq;               // Inject random interrupt latency
+static unsigned _seed;
+static uint16_t _mhz;
+static const i2c_spec_t *_spec;
+
+// Bus state as seen by a slave
+static bool _scl, _sda;
+static uint32_t _scl_at, _sda_at, _stop_at;
+static bool _started, _stopped;
+static uint32_t _rise_at, _rises, _periods, _period_sum, _period_min;
+
+// Shortest phase seen, in cycles
+static uint32_t _min_low, _min_high, _min_hd_sta, _min_su_sto, _min_buf;
+
+
+uint32_t i2c_ccount(void)
+{
+    _now += MODEL_CCOUNT_CYCLES;
+    return _now;
+}
+
+
+static void _maybe_irq(void)
+{
+    if (_irq && (rand_r(&_seed) % 8 == 0))
+        _now += rand_r(&_seed) % MODEL_IRQ_CYCLES;
+}
+
+
+static void _min(uint32_t *m, uint32_t v)
+{
+    if (v < *m)
+        *m = v;
+}
+
+
+static void _set_scl(bool v)
+{
+    _maybe_irq();
+    _now += MODEL_EDGE_CYCLES;
+    if (v == _scl)
+        return;
+    if (v)
+    {
+        _min(&_min_low, _now - _scl_at);
+        if (_rises && _started)
+        {
+            _period_sum += _now - _rise_at;
+            ++_periods;
+            _min(&_period_min, _now - _rise_at);
+        }
+        ++_rises;
+        _rise_at = _now;
+    }
+    else
+    {
+        _min(&_min_high, _now - _scl_at);
+        if (_started && (_sda_at > _scl_at))
+            _min(&_min_hd_sta, _now - _sda_at);     // first SCL fall after START
+    }
+    _scl = v;
+    _scl_at = _now;
+}
+
+
+static void _set_sda(bool v)
+{
+    _maybe_irq();
+    _now += MODEL_EDGE_CYCLES;
+    if (v == _sda)
+        return;
+    if (_scl && !v)
+    {
+        // START
+        if (_stopped)
+            _min(&_min_buf, _now - _stop_at);
+        _started = true;
+        _rises = 0;
+    }
+    else if (_scl && v)
+    {
+        // STOP
+        _min(&_min_su_sto, _now - _scl_at);
+        _stopped = true;
+        _stop_at = _now;
+    }
+    _sda = v;
+    _sda_at = _now;
+}
+
+
+// Phase loop from i2c.c, with GPIO writes replaced by the bus model
+#define _MARK (_maybe_irq(), _edge = i2c_ccount())
+#define _WAIT(cycles) while ((uint32_t)(i2c_ccount() - _edge) < (cycles))
+
+static i2c_timing_t _timing;
+
+static void _start(void)
+{
+    if (!_scl)
+    {
+        _set_sda(1);
+        _WAIT(_timing.low);
+        _set_scl(1);
+        _MARK;
+        _WAIT(_timing.su_sta);
+    }
+    else
+    {
+        _set_sda(1);
+        _WAIT(_timing.buf);
+    }
+    _set_sda(0);
+    _MARK;
+    _WAIT(_timing.hd_sta);
+    _set_scl(0);
+    _MARK;
+}
+
+
+static void _stop(void)
+{
+    _set_sda(0);
+    _WAIT(_timing.low);
+    _set_scl(1);
+    _MARK;
+    _WAIT(_timing.su_sto);
+    _set_sda(1);
+    _MARK;
+}
+
+
+static void _write(uint8_t data)
+{
+    uint8_t ibit;
+
+    for (ibit = 0; ibit < 9; ++ibit)
+    {
+        _set_sda((ibit == 8) || (data & 0x80));
+        _WAIT(_timing.low);
+        _set_scl(1);
+        _MARK;
+        data = data << 1;
+        _WAIT(_timing.high);
+        _set_scl(0);
+        _MARK;
+    }
+}
+
+
+static double _ns(uint32_t cycles)
+{
+    return cycles * 1000.0 / _mhz;
+}
+
+
+/**
+ * @brief   Run one speed mode and CPU clock through the model
+ * @return  Number of violations found
+ */
+static int _check(i2c_speed_t speed, uint16_t mhz, bool irq)
+{
+    int fail = 0;
+    uint8_t i;
+    double freq;
+
+    _mhz = mhz;
+    _spec = &i2c_specs[speed];
+    _irq = irq;
+    _seed = 1;
+    i2c_timing_calc(&_timing, speed, mhz);
+
+    _now = 1000;
+    _scl = _sda = true;
+    _scl_at = _sda_at = _stop_at = _now;
+    _started = _stopped = false;
+    _rises = _periods = _period_sum = 0;
+    _period_min = _min_low = _min_high = _min_hd_sta = _min_su_sto = _min_buf = UINT32_MAX;
+    _MARK;
+
+    // Two write transactions back to back, the second one also exercises tBUF
+    _start();
+    _write(0x78);
+    _write(0x40);
+    for (i = 0; i < 16; ++i)
+        _write(0xa5 ^ i);
+    _stop();
+    _start();
+    _write(0x78);
+    _write(0x00);
+    _stop();
+
+    freq = 1e9 / _ns(_period_sum / _periods);
+    printf("%-8s %3uMHz %s  low %3u high %3u cycles  min low %5.0f high %5.0f hd_sta %5.0f su_sto %5.0f buf %5.0f ns  %7.0f Hz\n",
+        _speed_names[speed], mhz, irq ? "irq" : "   ", _timing.low, _timing.high,
+        _ns(_min_low), _ns(_min_high), _ns(_min_hd_sta), _ns(_min_su_sto), _ns(_min_buf), freq);
+
+    if (_ns(_min_low) < _spec->low) { printf("  FAIL: tLOW below %u ns\n", _spec->low); ++fail; }
+    if (_ns(_min_high) < _spec->high + _spec->rise) { printf("  FAIL: tHIGH below %u ns\n", _spec->high + _spec->rise); ++fail; }
+    if (_ns(_min_hd_sta) < _spec->hd_sta) { printf("  FAIL: tHD;STA below %u ns\n", _spec->hd_sta); ++fail; }
+    if (_ns(_min_su_sto) < _spec->su_sto) { printf("  FAIL: tSU;STO below %u ns\n", _spec->su_sto); ++fail; }
+    if (_ns(_min_buf) < _spec->buf) { printf("  FAIL: tBUF below %u ns\n", _spec->buf); ++fail; }
+    if (1e9 / _ns(_period_min) > _spec->freq) { printf("  FAIL: clock above %u Hz\n", _spec->freq); ++fail; }
+    if (!irq && (freq < _spec->freq * MODEL_MIN_RATIO)) { printf("  FAIL: clock below %.0f%% of nominal\n", MODEL_MIN_RATIO * 100); ++fail; }
+    return fail;
+}
+
+
+int main(void)
+{
+    static const uint16_t clocks[] = { 80, 160 };
+    int fail = 0;
+    uint8_t s, c;
+
+    for (s = I2C_SPEED_STANDARD; s <= I2C_SPEED_FAST_PLUS; ++s)
+    {
+        for (c = 0; c < sizeof(clocks) / sizeof(clocks[0]); ++c)
+        {
+            fail += _check((i2c_speed_t)s, clocks[c], false);
+            fail += _check((i2c_speed_t)s, clocks[c], true);
+        }
+    }
+    printf("%s\n", fail ? "FAILED" : "OK");
+    return fail ? 1 : 0;
+}
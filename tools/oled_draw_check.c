@@ -0,0 +1,514 @@
+/**
+  ******************************************************************************
+  * @file    oled_draw_check.c
+  * @author  Baoshi <mail(at)ba0sh1(dot)com>
+  * @version 0.1
+  * @date    Dec 24, 2014
+  * @brief   Host check of the drawing primitives. Builds the real oled_i2c.c
+  *          against host/, answers its bus transactions with an SSD1306 model,
+  *          and compares what reaches display RAM with a per-pixel reference
+  *          of rectangles, bitmaps and text. Lines are checked for their shape
+  *          instead. Every drawing is run in buffer and display list mode.
+  *
+  *          Build and run with "make check" in this directory.
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Copyright (c) 2015, Baoshi Zhu. All rights reserved.
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "esp_common.h"
+#include "i2c.h"
+#include "i2c_bus.h"
+#include "oled_fonts.h"
+#include "oled.h"
+
+
+#define ID 1                // Panel 1 of OLED_PANELS: SSD1306 128x64 at 0x7a, no RESET line
+#define PANEL_ADDR 0x7a
+#define W 128
+#define H 64
+#define LIST_SIZE 1024      // Display list, holds a round of any operation
+#define ROUND 20            // Operations drawn between two refreshes
+
+
+// Debug output of oled_i2c.c goes to stdout
+void dmsg_puts(const char *s)
+{
+    fputs(s, stdout);
+}
+
+
+void host_gpio_write(uint32_t addr, uint32_t val)
+{
+}
+
+
+/*
+ * SSD1306 model, horizontal addressing mode only. Transactions go straight to the model instead
+ * of through i2c.c, the bus itself is checked by i2c_async_sim.
+ */
+static uint8_t _gddram[H / 8][W];
+static uint8_t _col_start, _col_end = W - 1, _page_start, _page_end = H / 8 - 1, _col, _page;
+static uint8_t _cmd[8], _cmd_len, _cmd_need;
+
+
+//! @brief Parameter bytes following a command byte
+static uint8_t _cmd_args(uint8_t c)
+{
+    switch (c)
+    {
+    case 0x20: case 0x81: case 0x8d: case 0xa8: case 0xd3: case 0xd5: case 0xd9: case 0xda: case 0xdb:
+        return 1;
+    case 0x21: case 0x22: case 0xa3:
+        return 2;
+    case 0x29: case 0x2a:
+        return 5;
+    case 0x26: case 0x27:
+        return 6;
+    }
+    return 0;
+}
+
+
+static void _panel_command(uint8_t c)
+{
+    if (_cmd_need == 0)
+    {
+        _cmd_len = 0;
+        _cmd_need = _cmd_args(c);
+    }
+    else
+    {
+        --_cmd_need;
+    }
+    _cmd[_cmd_len++] = c;
+    if (_cmd_need)
+        return;
+    if (_cmd[0] == 0x21)
+    {
+        _col = _col_start = _cmd[1] % W;
+        _col_end = _cmd[2] % W;
+    }
+    else if (_cmd[0] == 0x22)
+    {
+        _page = _page_start = _cmd[1] % (H / 8);
+        _page_end = _cmd[2] % (H / 8);
+    }
+}
+
+
+static void _panel_data(uint8_t d)
+{
+    _gddram[_page][_col] = d;
+    if (_col++ == _col_end)
+    {
+        _col = _col_start;
+        _page = (_page == _page_end) ? _page_start : _page + 1;
+    }
+}
+
+
+bool i2c_bus_transfer(uint8_t lane, i2c_bus_prio_t prio, const i2c_bus_seg_t *segs, uint8_t count)
+{
+    bool data = false, head = false;
+    uint8_t i;
+    uint16_t k;
+
+    for (i = 0; i < count; ++i)
+    {
+        if (!(segs[i].flags & I2C_SEG_CONTINUE))
+        {
+            if ((segs[i].address != PANEL_ADDR) || (segs[i].flags & I2C_SEG_READ))
+                return false;
+            head = true;
+        }
+        for (k = 0; k < segs[i].len; ++k)
+        {
+            if (head)
+            {
+                // Control byte, D/C selects what the rest of the transaction is
+                data = segs[i].wbuf[k] & 0x40;
+                head = false;
+            }
+            else if (data)
+            {
+                _panel_data(segs[i].wbuf[k]);
+            }
+            else
+            {
+                _panel_command(segs[i].wbuf[k]);
+            }
+        }
+    }
+    return true;
+}
+
+
+void i2c_bus_run(i2c_bus_prio_t prio, i2c_bus_fn_t fn, void *arg)
+{
+    fn(arg);
+}
+
+
+bool i2c_dual_write(const i2c_lane_t *lane0, const i2c_lane_t *lane1, uint16_t acked[2])
+{
+    return false;
+}
+
+
+/*
+ * Reference, one byte per pixel
+ */
+static uint8_t _ref[H][W];
+static uint8_t _frame[2][H][W];     // Panel after refresh, buffer and display list mode
+
+
+static void _ref_pixel(int x, int y, int color)
+{
+    if ((x < 0) || (y < 0) || (x >= W) || (y >= H))
+        return;
+    if (color == OLED_COLOR_WHITE)
+        _ref[y][x] = 1;
+    else if (color == OLED_COLOR_BLACK)
+        _ref[y][x] = 0;
+    else if (color == OLED_COLOR_INVERT)
+        _ref[y][x] ^= 1;
+}
+
+
+//! @brief Refresh the whole panel and read display RAM into frame
+static void _grab(uint8_t frame[H][W])
+{
+    int x, y;
+
+    oled_refresh(ID, true);
+    for (y = 0; y < H; ++y)
+        for (x = 0; x < W; ++x)
+            frame[y][x] = (_gddram[y / 8][x] >> (y & 7)) & 0x01;
+}
+
+
+/*
+ * Operations drawn in a round
+ */
+enum { OP_FILL, OP_BITMAP, OP_CHAR, OP_LINE };
+
+typedef struct _op
+{
+    uint8_t kind;
+    int16_t x, y, w, h;     // Line from (x, y) to (w, h)
+    int8_t color, background;
+    uint8_t font, format, rop;
+    uint16_t c;
+    uint8_t bitmap[200], mask[200];     // 40 x 40 pixels in either format
+    bool has_mask;
+} op_t;
+
+static op_t _ops[ROUND];
+static uint32_t _seed = 1;
+
+
+//! @brief Deterministic random number 0 to n - 1, same sequence on every host
+static int _rand(int n)
+{
+    _seed = _seed * 1103515245 + 12345;
+    return (int)((_seed >> 8) % (uint32_t)n);
+}
+
+
+static int _rand_range(int lo, int hi)
+{
+    return lo + _rand(hi - lo + 1);
+}
+
+
+static int8_t _rand_color(void)
+{
+    static const int8_t colors[] = { OLED_COLOR_TRANSPARENT, OLED_COLOR_BLACK, OLED_COLOR_WHITE, OLED_COLOR_INVERT };
+    return colors[_rand(4)];
+}
+
+
+static void _draw(const op_t *op)
+{
+    switch (op->kind)
+    {
+    case OP_FILL:
+        oled_fill_rectangle(ID, op->x, op->y, op->w, op->h, op->color);
+        break;
+    case OP_BITMAP:
+        oled_draw_bitmap(ID, op->x, op->y, op->bitmap, op->has_mask ? op->mask : NULL, op->w, op->h, op->format, op->rop);
+        break;
+    case OP_CHAR:
+        oled_select_font(ID, op->font);
+        oled_draw_char(ID, op->x, op->y, op->c, op->color, op->background);
+        break;
+    case OP_LINE:
+        oled_draw_line(ID, op->x, op->y, op->w, op->h, op->color);
+        break;
+    }
+}
+
+
+//! @brief Bitmap pixel in OLED_BITMAP_PAGE or OLED_BITMAP_ROW layout
+static int _bit(const uint8_t *b, int format, int w, int x, int y)
+{
+    if (format == OLED_BITMAP_PAGE)
+        return (b[(y / 8) * w + x] >> (y & 7)) & 0x01;
+    return (b[y * ((w + 7) / 8) + x / 8] >> (7 - (x & 7))) & 0x01;
+}
+
+
+//! @brief Glyph of code point, by linear search so it does not share the driver's lookup
+static const font_char_desc_t *_glyph(const font_info_t *font, uint16_t c)
+{
+    uint16_t i;
+
+    if (font->ranges == NULL)
+    {
+        if ((c >= font->char_start) && (c <= font->char_end))
+            return font->char_descriptors + (c - font->char_start);
+    }
+    else
+    {
+        for (i = 0; i < font->range_count; ++i)
+            if ((c >= font->ranges[i].first) && (c <= font->ranges[i].last))
+                return font->char_descriptors + font->ranges[i].index + (c - font->ranges[i].first);
+    }
+    return (c != ' ') ? _glyph(font, ' ') : NULL;
+}
+
+
+static void _ref_draw(const op_t *op)
+{
+    const font_info_t *font;
+    const font_char_desc_t *desc;
+    int x, y, b;
+
+    switch (op->kind)
+    {
+    case OP_FILL:
+        for (y = op->y; y < op->y + op->h; ++y)
+            for (x = op->x; x < op->x + op->w; ++x)
+                _ref_pixel(x, y, op->color);
+        break;
+    case OP_BITMAP:
+        for (y = 0; y < op->h; ++y)
+            for (x = 0; x < op->w; ++x)
+            {
+                b = _bit(op->bitmap, op->format, op->w, x, y);
+                if (op->rop == OLED_ROP_COPY)
+                    _ref_pixel(op->x + x, op->y + y, b ? OLED_COLOR_WHITE : OLED_COLOR_BLACK);
+                else if ((op->rop == OLED_ROP_OR) && b)
+                    _ref_pixel(op->x + x, op->y + y, OLED_COLOR_WHITE);
+                else if ((op->rop == OLED_ROP_AND) && !b)
+                    _ref_pixel(op->x + x, op->y + y, OLED_COLOR_BLACK);
+                else if ((op->rop == OLED_ROP_XOR) && b)
+                    _ref_pixel(op->x + x, op->y + y, OLED_COLOR_INVERT);
+                else if ((op->rop == OLED_ROP_MASKED) && (!op->has_mask || _bit(op->mask, op->format, op->w, x, y)))
+                    _ref_pixel(op->x + x, op->y + y, b ? OLED_COLOR_WHITE : OLED_COLOR_BLACK);
+            }
+        break;
+    case OP_CHAR:
+        // Like the old per-pixel renderer: an inverting background is not drawn
+        font = oled_fonts[op->font];
+        desc = _glyph(font, op->c);
+        for (y = 0; y < font->height; ++y)
+            for (x = 0; x < desc->width; ++x)
+            {
+                if (_bit(font->bitmap + desc->offset, OLED_BITMAP_PAGE, desc->width, x, y))
+                    _ref_pixel(op->x + x, op->y + y, op->color);
+                else if (op->background != OLED_COLOR_INVERT)
+                    _ref_pixel(op->x + x, op->y + y, op->background);
+            }
+        break;
+    }
+}
+
+
+static void _gen(op_t *op, int kind)
+{
+    static const uint16_t tahoma[] = { 0xb0, 0x2190, 0x2191, 0x2192, 0x2193, 0x2194, 0x00e9, 0x4e2d };
+    int i, n;
+
+    memset(op, 0, sizeof(op_t));
+    op->kind = kind;
+    switch (kind)
+    {
+    case OP_FILL:
+        // Corners anywhere around the panel, clipped at every edge
+        op->x = _rand_range(-40, W + 20);
+        op->y = _rand_range(-40, H + 20);
+        op->w = _rand(W + 40);
+        op->h = _rand(H + 40);
+        op->color = _rand_color();
+        break;
+    case OP_BITMAP:
+        op->w = _rand_range(1, 40);
+        op->h = _rand_range(1, 40);
+        op->x = _rand_range(-op->w, W);
+        op->y = _rand_range(-op->h, H);
+        op->format = _rand(2);
+        op->rop = _rand(5);
+        op->has_mask = _rand(4) != 0;
+        n = (op->format == OLED_BITMAP_PAGE) ? op->w * ((op->h + 7) / 8) : ((op->w + 7) / 8) * op->h;
+        for (i = 0; i < n; ++i)
+        {
+            op->bitmap[i] = _rand(256);
+            op->mask[i] = _rand(256);
+        }
+        break;
+    case OP_CHAR:
+        op->font = _rand(OLED_NUM_FONTS);
+        op->x = _rand_range(-12, W + 2);
+        op->y = _rand_range(-16, H + 2);
+        op->color = _rand_color();
+        op->background = _rand_color();
+        if (op->font == 0)
+            op->c = _rand(256);
+        else if (_rand(4))
+            op->c = _rand_range(32, 126);
+        else
+            op->c = tahoma[_rand(sizeof(tahoma) / sizeof(tahoma[0]))];  // Some are not in the font
+        break;
+    case OP_LINE:
+        op->x = _rand_range(-60, W + 60);
+        op->y = _rand_range(-60, H + 60);
+        op->w = _rand_range(-60, W + 60);
+        op->h = _rand_range(-60, H + 60);
+        op->color = OLED_COLOR_INVERT;
+        break;
+    }
+}
+
+
+/**
+ * @brief   Draw rounds of random operations of one kind in buffer and display list mode
+ * @param   ref     Compare with the reference, otherwise only the two modes with each other
+ * @return  Number of rounds that did not match
+ */
+static int _rounds(int kind, int rounds, bool ref)
+{
+    int r, i, m, bad = 0;
+
+    for (r = 0; r < rounds; ++r)
+    {
+        for (i = 0; i < ROUND; ++i)
+            _gen(_ops + i, kind);
+        memset(_ref, 0, sizeof(_ref));
+        for (i = 0; i < ROUND; ++i)
+            _ref_draw(_ops + i);
+        for (m = 0; m < 2; ++m)
+        {
+            oled_set_display_list(ID, m == 1, LIST_SIZE);
+            oled_clear(ID);
+            for (i = 0; i < ROUND; ++i)
+                _draw(_ops + i);
+            _grab(_frame[m]);
+        }
+        oled_set_display_list(ID, false, 0);
+        if ((ref && memcmp(_frame[0], _ref, sizeof(_ref))) || memcmp(_frame[0], _frame[1], sizeof(_ref)))
+            ++bad;
+    }
+    return bad;
+}
+
+
+/**
+ * @brief   Draw single lines inverted on a clear panel and check their shape: one pixel per step
+ *          of the longer axis, no pixel further than half a pixel from the ideal line, and both
+ *          ends drawn if they are on the panel. Clipped lines may be off by one more pixel where
+ *          the clip point is rounded.
+ * @return  Number of lines that failed
+ */
+static int _lines(int count)
+{
+    op_t op;
+    int n, bad = 0, x, y, major, minor, dmajor, dminor, m0, n0, lit;
+    bool steep, inside, ok;
+    double ideal, tol;
+
+    for (n = 0; n < count; ++n)
+    {
+        _gen(&op, OP_LINE);
+        oled_clear(ID);
+        _draw(&op);
+        _grab(_frame[0]);
+        steep = abs(op.h - op.y) > abs(op.w - op.x);
+        inside = (op.x >= 0) && (op.x < W) && (op.w >= 0) && (op.w < W)
+            && (op.y >= 0) && (op.y < H) && (op.h >= 0) && (op.h < H);
+        m0 = steep ? op.y : op.x;
+        n0 = steep ? op.x : op.y;
+        dmajor = steep ? op.h - op.y : op.w - op.x;
+        dminor = steep ? op.w - op.x : op.h - op.y;
+        tol = inside ? 0.5 + 1e-9 : 1.0 + 1e-9;
+        ok = true;
+        for (major = 0; major < (steep ? H : W); ++major)
+        {
+            lit = 0;
+            for (minor = 0; minor < (steep ? W : H); ++minor)
+            {
+                x = steep ? minor : major;
+                y = steep ? major : minor;
+                if (!_frame[0][y][x])
+                    continue;
+                ++lit;
+                ideal = dmajor ? n0 + (double)(major - m0) * dminor / dmajor : n0;
+                if ((major - m0) * (dmajor < 0 ? -1 : 1) < 0 || (major - m0) * (dmajor < 0 ? -1 : 1) > abs(dmajor)
+                    || fabs(minor - ideal) > tol)
+                    ok = false;
+            }
+            // Every major step the line covers holds one pixel, when it is not clipped
+            if ((lit > 1) || (inside && (lit == 0) && ((major - m0) * (dmajor < 0 ? -1 : 1) >= 0)
+                && ((major - m0) * (dmajor < 0 ? -1 : 1) <= abs(dmajor))))
+                ok = false;
+        }
+        if (inside && (!_frame[0][op.y][op.x] || !_frame[0][op.h][op.w]))
+            ok = false;
+        if (!ok)
+        {
+            if (bad < 5)
+                printf("    line (%d, %d) - (%d, %d)\n", op.x, op.y, op.w, op.h);
+            ++bad;
+        }
+    }
+    return bad;
+}
+
+
+static int _expect(const char *what, bool ok)
+{
+    printf("  %-44s %s\n", what, ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+
+int main(void)
+{
+    int fail = 0;
+
+    if (!oled_init(ID))
+    {
+        printf("FAILED\n");
+        return 1;
+    }
+    fail += _expect("3000 rectangles match reference", _rounds(OP_FILL, 150, true) == 0);
+    fail += _expect("4000 bitmaps match reference", _rounds(OP_BITMAP, 200, true) == 0);
+    fail += _expect("4000 characters match reference", _rounds(OP_CHAR, 200, true) == 0);
+    fail += _expect("20000 lines have the ideal line's shape", _lines(20000) == 0);
+    fail += _expect("2000 lines same in display list mode", _rounds(OP_LINE, 100, false) == 0);
+    oled_term(ID);
+    printf("%s\n", fail ? "FAILED" : "OK");
+    return fail ? 1 : 0;
+}
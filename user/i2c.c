@@ -21,6 +21,7 @@
 
 #include "esp_common.h"
 #include "i2c.h"
+#include "dmsg.h"
 
 
 /**
@@ -46,8 +47,26 @@
 //! @brief GPIO bit location for SCL pin
 #define SCL_BIT  BIT4
 
-//! Delay amount in-between bits, with os_delay_us(1) I get ~300kHz I2C clock
-#define _DELAY os_delay_us(1)
+//! @brief Set to 1 to use a second SDA pin (lane 1) sharing SCL with lane 0, see i2c_dual_write()
+#define I2C_DUAL_LANE 0
+
+//! @brief GPIO MUX for lane 1 SDA pin
+#define SDA_LANE1_MUX  PERIPHS_IO_MUX_MTCK_U
+//! @brief GPIO FUNC for lane 1 SDA pin
+#define SDA_LANE1_FUNC FUNC_GPIO13
+//! @brief GPIO pin location for lane 1 SDA pin
+#define SDA_LANE1_PIN  13
+//! @brief GPIO bit location for lane 1 SDA pin
+#define SDA_LANE1_BIT  BIT13
+
+//! Bus speed selected by i2c_init(), see i2c_set_speed()
+#define I2C_DEFAULT_SPEED I2C_SPEED_FAST
+
+//! @brief FRC1 interrupt period of the asynchronous engine in microseconds
+#define I2C_ASYNC_TICK_US 100
+//! @brief Bus phases (half bits) run per FRC1 interrupt. 18 phases move one byte. Together with
+//!        I2C_ASYNC_TICK_US this sets asynchronous throughput against time spent in interrupt.
+#define I2C_ASYNC_PHASES_PER_TICK 18
 
 /** @} */
 
@@ -57,16 +76,34 @@
 #define GPIO_PIN_ADDR(i) (GPIO_PIN0_ADDRESS + i*4)
 #endif
 
-#define _SDA1 GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, SDA_BIT)
-#define _SDA0 GPIO_REG_WRITE(GPIO_OUT_W1TC_ADDRESS, SDA_BIT)
+#define _SDA1 GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, _sda_bit)
+#define _SDA0 GPIO_REG_WRITE(GPIO_OUT_W1TC_ADDRESS, _sda_bit)
 
 #define _SCL1 GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, SCL_BIT)
 #define _SCL0 GPIO_REG_WRITE(GPIO_OUT_W1TC_ADDRESS, SCL_BIT)
 
-#define _SDAX ((GPIO_REG_READ(GPIO_IN_ADDRESS) >> SDA_PIN) & 0x01)
+#define _SDAX ((GPIO_REG_READ(GPIO_IN_ADDRESS) >> _sda_pin) & 0x01)
 #define _SCLX ((GPIO_REG_READ(GPIO_IN_ADDRESS) >> SCL_PIN) & 0x01)
 
 
+/*
+ * Bit timing is kept against the CPU cycle counter instead of os_delay_us(). Each phase waits until
+ * its cycle budget has elapsed since the edge that started it, so the work done inside a phase
+ * (shifting data, sampling SDA) is absorbed instead of added to the bit time. The bus primitives carry no
+ * ICACHE_FLASH_ATTR so they are linked into IRAM and never stall on a flash cache miss mid-bit.
+ */
+
+LOCAL i2c_timing_t _timing;     // Phase lengths in CPU cycles for current speed and CPU clock
+LOCAL uint32_t _edge;           // Cycle count of the edge that started current bus phase
+LOCAL uint32_t _sda_bit = SDA_BIT;  // SDA of the lane used by single lane primitives
+LOCAL uint8_t _sda_pin = SDA_PIN;
+
+//! Mark start of a bus phase in e, right after driving its edge. An interrupt in-between only lengthens the phase.
+#define _MARK(e) (e = i2c_ccount())
+//! Wait until the bus phase started at e has lasted cycles
+#define _WAIT(e, cycles) while ((uint32_t)(i2c_ccount() - (e)) < (cycles))
+
+
 void ICACHE_FLASH_ATTR i2c_init(void)
 {
     // MUX selection
@@ -85,71 +122,207 @@ void ICACHE_FLASH_ATTR i2c_init(void)
         GPIO_PIN_ADDR(GPIO_ID_PIN(SCL_PIN)),
         GPIO_REG_READ(GPIO_PIN_ADDR(GPIO_ID_PIN(SCL_PIN))) | GPIO_PIN_PAD_DRIVER_SET(GPIO_PAD_DRIVER_ENABLE)
     );
+#if (I2C_DUAL_LANE == 1)
+    PIN_FUNC_SELECT(SDA_LANE1_MUX, SDA_LANE1_FUNC);
+    GPIO_REG_WRITE
+    (
+        GPIO_PIN_ADDR(GPIO_ID_PIN(SDA_LANE1_PIN)),
+        GPIO_REG_READ(GPIO_PIN_ADDR(GPIO_ID_PIN(SDA_LANE1_PIN))) | GPIO_PIN_PAD_DRIVER_SET(GPIO_PAD_DRIVER_ENABLE)
+    );
+    GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, SDA_LANE1_BIT);
+    GPIO_REG_WRITE(GPIO_ENABLE_ADDRESS, GPIO_REG_READ(GPIO_ENABLE_ADDRESS) | SDA_LANE1_BIT);
+#endif
     // Set idle bus high
     _SDA1;
     _SCL1;
     // Set both output
     GPIO_REG_WRITE(GPIO_ENABLE_ADDRESS, GPIO_REG_READ(GPIO_ENABLE_ADDRESS) | SDA_BIT | SCL_BIT);
+    i2c_set_speed(I2C_DEFAULT_SPEED);
+    _MARK(_edge);
     return;
 }
 
 
-bool ICACHE_FLASH_ATTR i2c_start(void)
+void ICACHE_FLASH_ATTR i2c_set_speed(i2c_speed_t speed)
 {
-    _SDA1;
-    _SCL1;
-    _DELAY;
+    i2c_timing_calc(&_timing, speed, system_get_cpu_freq());
+}
+
+
+void ICACHE_FLASH_ATTR i2c_select_lane(uint8_t lane)
+{
+#if (I2C_DUAL_LANE == 1)
+    _sda_bit = lane ? SDA_LANE1_BIT : SDA_BIT;
+    _sda_pin = lane ? SDA_LANE1_PIN : SDA_PIN;
+#else
+    if (lane != 0)
+        dmsg_err_puts("I2C lane 1 not available, enable I2C_DUAL_LANE.");
+#endif
+}
+
+
+bool i2c_start(void)
+{
+    if (_SCLX == 0)
+    {
+        // Repeated START, release SDA while SCL is low then raise SCL
+        _SDA1;
+        _WAIT(_edge, _timing.low);
+        _SCL1;
+        while (_SCLX == 0); // clock stretching
+        _MARK(_edge);
+        _WAIT(_edge, _timing.su_sta);
+    }
+    else
+    {
+        // Bus free time since the last STOP
+        _SDA1;
+        _WAIT(_edge, _timing.buf);
+    }
     if (_SDAX == 0) return false; // Bus busy
     _SDA0;
-    _DELAY;
+    _MARK(_edge);
+    _WAIT(_edge, _timing.hd_sta);
     _SCL0;
+    _MARK(_edge);
     return true;
 }
 
 
-
-void ICACHE_FLASH_ATTR i2c_stop(void)
+void i2c_stop(void)
 {
     _SDA0;
+    _WAIT(_edge, _timing.low);
     _SCL1;
-    _DELAY;
     while (_SCLX == 0); // clock stretching
+    _MARK(_edge);
+    _WAIT(_edge, _timing.su_sto);
     _SDA1;
-    _DELAY;
+    _MARK(_edge);
 }
 
 
 // return: true - ACK; false - NACK
-bool ICACHE_FLASH_ATTR i2c_write(uint8_t data)
+bool i2c_write(uint8_t data)
+{
+    return (i2c_write_buf(&data, 1) == 1);
+}
+
+
+/*
+ * The buffer loops below keep the phase start and bit timing in locals so the whole transfer
+ * runs out of registers, and only store the phase start back for the next primitive at the end.
+ */
+
+uint16_t i2c_write_buf(const uint8_t *buf, uint16_t len)
 {
-    uint8_t ibit;
-    bool ret;
+    uint32_t edge = _edge, low = _timing.low, high = _timing.high;
+    uint16_t n;
+    uint8_t data, ibit;
+    bool ack = true;
 
-    for (ibit = 0; ibit < 8; ++ibit)
+    for (n = 0; (n < len) && ack; ++n)
     {
-        if (data & 0x80)
-            _SDA1;
-        else
+        data = buf[n];
+        for (ibit = 0; ibit < 8; ++ibit)
+        {
+            if (data & 0x80)
+                _SDA1;
+            else
+                _SDA0;
+            data = data << 1;
+            _WAIT(edge, low);
+            _SCL1;
+            _MARK(edge);
+            _WAIT(edge, high);
+            _SCL0;
+            _MARK(edge);
+        }
+        _SDA1;
+        _WAIT(edge, low);
+        _SCL1;
+        _MARK(edge);
+        _WAIT(edge, high);
+        ack = (_SDAX == 0);
+        _SCL0;
+        _MARK(edge);
+    }
+    _edge = edge;
+
+    return ack ? n : n - 1;
+}
+
+
+uint16_t i2c_read_buf(uint8_t *buf, uint16_t len)
+{
+    uint32_t edge = _edge, low = _timing.low, high = _timing.high;
+    uint16_t n;
+    uint8_t data, ibit;
+
+    for (n = 0; n < len; ++n)
+    {
+        _SDA1;
+        data = 0;
+        for (ibit = 0; ibit < 8; ++ibit)
+        {
+            data = data << 1;
+            _WAIT(edge, low);
+            _SCL1;
+            _MARK(edge);
+            _WAIT(edge, high);
+            if (_SDAX)
+                data = data | 0x01;
+            _SCL0;
+            _MARK(edge);
+        }
+        buf[n] = data;
+        // ACK all but the last byte
+        if (n != len - 1)
             _SDA0;
-        _DELAY;
+        _WAIT(edge, low);
         _SCL1;
-        _DELAY;
-        data = data << 1;
+        _MARK(edge);
+        _WAIT(edge, high);
         _SCL0;
+        _MARK(edge);
     }
     _SDA1;
-    _DELAY;
-    _SCL1;
-    _DELAY;
-    ret = (_SDAX == 0);
-    _SCL0;
-    _DELAY;
+    _edge = edge;
+
+    return n;
+}
+
+
+uint16_t ICACHE_FLASH_ATTR i2c_write_read(uint8_t address, const uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    uint16_t n = 0;
+
+    if (!i2c_start())
+        return 0;
+    if (wlen)
+    {
+        if (!i2c_write(address & 0xfe))
+        {
+            i2c_stop();
+            return 0;
+        }
+        n = i2c_write_buf(wbuf, wlen);
+        if ((n != wlen) || (rlen == 0))
+        {
+            i2c_stop();
+            return n;
+        }
+        i2c_start();    // Repeated START
+    }
+    if (i2c_write(address | 0x01))
+        n += i2c_read_buf(rbuf, rlen);
+    i2c_stop();
 
-    return ret;
+    return n;
 }
 
 
-uint8_t ICACHE_FLASH_ATTR i2c_read(void)
+uint8_t i2c_read(void)
 {
     uint8_t data = 0;
     uint8_t ibit = 8;
@@ -158,33 +331,501 @@ uint8_t ICACHE_FLASH_ATTR i2c_read(void)
     while (ibit--)
     {
         data = data << 1;
-        _SCL0;
-        _DELAY;
+        _WAIT(_edge, _timing.low);
         _SCL1;
-        _DELAY;
+        _MARK(_edge);
+        _WAIT(_edge, _timing.high);
         if (_SDAX)
             data = data | 0x01;
+        _SCL0;
+        _MARK(_edge);
     }
-    _SCL0;
 
     return data;
 }
 
 
-void ICACHE_FLASH_ATTR i2c_set_ack(bool ack)
+void i2c_set_ack(bool ack)
 {
-    _SCL0;
     if (ack)
         _SDA0;  // ACK
     else
         _SDA1;  // NACK
-    _DELAY;
+    _WAIT(_edge, _timing.low);
     // Send clock
     _SCL1;
-    _DELAY;
+    _MARK(_edge);
+    _WAIT(_edge, _timing.high);
     _SCL0;
-    _DELAY;
+    _MARK(_edge);
     // ACK end
     _SDA1;
 }
 
+
+#if (I2C_DUAL_LANE == 1)
+
+//! @brief Progress of one lane through its i2c_lane_t
+typedef struct _i2c_cursor
+{
+    const i2c_lane_t *lane;
+    const uint8_t *p;       // next byte
+    uint16_t left;          // bytes left in current row (or head)
+    uint8_t rows;           // rows left after current one
+    bool in_head;
+} i2c_cursor;
+
+
+LOCAL void _cursor_init(i2c_cursor *c, const i2c_lane_t *lane)
+{
+    c->lane = lane;
+    c->p = lane->head;
+    c->left = lane->head_len;
+    c->rows = lane->rows;
+    c->in_head = true;
+}
+
+
+LOCAL bool _cursor_next(i2c_cursor *c, uint8_t *data)
+{
+    while (c->left == 0)
+    {
+        if (c->rows == 0)
+            return false;
+        c->p = c->in_head ? c->lane->buf : (c->p - c->lane->len + c->lane->stride);
+        c->left = c->lane->len;
+        c->in_head = false;
+        --c->rows;
+    }
+    *data = *c->p++;
+    --c->left;
+    return true;
+}
+
+
+/*
+ * Both lanes are clocked by the same SCL edges, and their SDA bits go out in the same pair of
+ * W1TS/W1TC register writes. A lane that is done (out of data or NACK'ed) pulls SDA low at the start
+ * of the other lane's next bit and releases it while SCL is high, which is a STOP for its own slave.
+ * After that its SDA stays released and its slave ignores the remaining clocks.
+ */
+bool i2c_dual_write(const i2c_lane_t *lane0, const i2c_lane_t *lane1, uint16_t acked[2])
+{
+    static const uint32_t bits[2] = { SDA_BIT, SDA_LANE1_BIT };
+    static const uint8_t pins[2] = { SDA_PIN, SDA_LANE1_PIN };
+    uint32_t edge = _edge, low = _timing.low, high = _timing.high;
+    uint32_t open = 0, stopping = 0, set, clr, in;
+    i2c_cursor c[2];
+    uint8_t data[2], l, ibit;
+
+    acked[0] = acked[1] = 0;
+    if (lane0)
+    {
+        _cursor_init(&c[0], lane0);
+        open |= SDA_BIT;
+    }
+    if (lane1)
+    {
+        _cursor_init(&c[1], lane1);
+        open |= SDA_LANE1_BIT;
+    }
+
+    // START on all lanes together
+    GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, open);
+    _WAIT(edge, _timing.buf);
+    if ((GPIO_REG_READ(GPIO_IN_ADDRESS) & open) != open)
+        return false; // Bus busy
+    GPIO_REG_WRITE(GPIO_OUT_W1TC_ADDRESS, open);
+    _MARK(edge);
+    _WAIT(edge, _timing.hd_sta);
+    _SCL0;
+    _MARK(edge);
+
+    for (;;)
+    {
+        for (l = 0; l < 2; ++l)
+        {
+            if ((open & bits[l]) && !_cursor_next(&c[l], &data[l]))
+            {
+                open &= ~bits[l];
+                stopping |= bits[l];
+            }
+        }
+        if (open == 0)
+            break;
+        for (ibit = 0; ibit < 8; ++ibit)
+        {
+            set = clr = 0;
+            for (l = 0; l < 2; ++l)
+            {
+                if (open & bits[l])
+                {
+                    if (data[l] & 0x80)
+                        set |= bits[l];
+                    else
+                        clr |= bits[l];
+                    data[l] = data[l] << 1;
+                }
+            }
+            if (ibit == 0)
+                clr |= stopping;
+            GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, set);
+            GPIO_REG_WRITE(GPIO_OUT_W1TC_ADDRESS, clr);
+            _WAIT(edge, low);
+            _SCL1;
+            _MARK(edge);
+            if (stopping)
+            {
+                // STOP for finished lanes, inside this bit's high phase
+                _WAIT(edge, _timing.su_sto);
+                GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, stopping);
+                stopping = 0;
+            }
+            _WAIT(edge, high);
+            _SCL0;
+            _MARK(edge);
+        }
+        // ACK
+        GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, open);
+        _WAIT(edge, low);
+        _SCL1;
+        _MARK(edge);
+        _WAIT(edge, high);
+        in = GPIO_REG_READ(GPIO_IN_ADDRESS);
+        _SCL0;
+        _MARK(edge);
+        for (l = 0; l < 2; ++l)
+        {
+            if (!(open & bits[l]))
+                continue;
+            if ((in >> pins[l]) & 0x01)
+            {
+                // NACK, end this lane
+                open &= ~bits[l];
+                stopping |= bits[l];
+            }
+            else
+            {
+                ++acked[l];
+            }
+        }
+    }
+
+    // STOP on lanes that finished last
+    GPIO_REG_WRITE(GPIO_OUT_W1TC_ADDRESS, stopping);
+    _WAIT(edge, low);
+    _SCL1;
+    while (_SCLX == 0); // clock stretching
+    _MARK(edge);
+    _WAIT(edge, _timing.su_sto);
+    GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, stopping);
+    _MARK(edge);
+    _edge = edge;
+
+    return true;
+}
+
+#else
+
+bool ICACHE_FLASH_ATTR i2c_dual_write(const i2c_lane_t *lane0, const i2c_lane_t *lane1, uint16_t acked[2])
+{
+    // Lane 1 not configured
+    acked[0] = acked[1] = 0;
+    return false;
+}
+
+#endif
+
+
+/*
+ * Asynchronous engine. Transactions are queued as descriptors and worked through by the FRC1 timer
+ * interrupt, a few bus phases per interrupt, so the CPU is only held for a short burst at a time.
+ * Each step drives exactly one bus edge (or samples SDA) after the previous phase has lasted its
+ * minimum time. The bus is static between interrupts, so a long gap between ticks only slows
+ * the clock down.
+ */
+
+//! @brief Asynchronous engine state, one bus edge per state
+enum
+{
+    _AS_IDLE = 0,       // Waiting for a transaction
+    _AS_LOW,            // SCL low, drive SDA for current bit
+    _AS_HIGH,           // SCL high
+    _AS_SAMPLE,         // End of SCL high, sample SDA and choose what follows
+    _AS_RESTART_LOW,    // SCL low, release SDA for repeated START
+    _AS_RESTART_HIGH,   // SCL high
+    _AS_START,          // SDA low while SCL high
+    _AS_STOP_LOW,       // SCL low, SDA low
+    _AS_STOP_HIGH,      // SCL high
+    _AS_STOP,           // SDA high while SCL high, transaction done
+};
+
+//! @brief Part of the transaction the current byte belongs to
+enum
+{
+    _AS_ADDR_W = 0,
+    _AS_WRITE,
+    _AS_ADDR_R,
+    _AS_READ,
+};
+
+LOCAL i2c_async_xfer_t * volatile _as_head = NULL;  // Transaction in progress, then the queue
+LOCAL i2c_async_xfer_t *_as_tail = NULL;
+LOCAL uint8_t _as_state = _AS_IDLE;
+LOCAL uint8_t _as_stage;
+LOCAL uint8_t _as_byte;         // Byte being shifted
+LOCAL uint8_t _as_bit;          // Bit of current byte, 8 is the ACK slot
+LOCAL uint16_t _as_index;       // Position in write or read buffer
+LOCAL uint32_t _as_edge;        // Cycle count of last edge
+LOCAL uint32_t _as_wait;        // Cycles the current phase must last
+LOCAL volatile bool _as_running = false;    // FRC1 armed
+LOCAL uint8_t _as_phases = I2C_ASYNC_PHASES_PER_TICK;
+LOCAL uint16_t _as_tick_us = I2C_ASYNC_TICK_US;
+
+// FRC1 control bits, not in SDK headers
+#define _FRC1_ENABLE_TIMER BIT7
+#define _FRC1_AUTO_LOAD    BIT6
+#define _FRC1_DIV_16       4
+#define _FRC1_TICKS(us)    ((us) * 5)   // 80MHz APB clock / 16
+
+
+LOCAL void _as_load(i2c_async_xfer_t *x)
+{
+    switch (_as_stage)
+    {
+    case _AS_ADDR_W:
+        _as_byte = x->address & 0xfe;
+        break;
+    case _AS_WRITE:
+        _as_byte = x->wbuf[_as_index];
+        break;
+    case _AS_ADDR_R:
+        _as_byte = x->address | 0x01;
+        break;
+    default:
+        _as_byte = 0;
+        break;
+    }
+    _as_bit = 0;
+}
+
+
+LOCAL void _as_phase(uint32_t next)
+{
+    _MARK(_as_edge);
+    _as_wait = next;
+}
+
+
+/**
+ * @brief   Run one step of the asynchronous state machine
+ * @return  false if there is nothing to do
+ */
+LOCAL bool _as_step(void)
+{
+    i2c_async_xfer_t *x = _as_head;
+    bool sda;
+
+    if (x == NULL)
+        return false;
+    _WAIT(_as_edge, _as_wait);
+    switch (_as_state)
+    {
+    case _AS_IDLE:
+        // Bus free time since the last STOP has passed, START
+        x->status = I2C_ASYNC_BUSY;
+        x->done = 0;
+        // An empty transaction is an address+W probe, a slave may drive SDA right after address+R
+        _as_stage = (x->wlen || !x->rlen) ? _AS_ADDR_W : _AS_ADDR_R;
+        _as_index = 0;
+        _as_load(x);
+        _SDA0;
+        _as_phase(_timing.hd_sta);
+        _as_state = _AS_LOW;
+        break;
+    case _AS_LOW:
+        _SCL0;
+        if (_as_bit < 8)
+            sda = (_as_stage == _AS_READ) || (_as_byte & 0x80);
+        else if (_as_stage == _AS_READ)
+            sda = (_as_index + 1 == x->rlen);   // ACK, NACK the last byte
+        else
+            sda = true;                         // Release for slave ACK
+        if (sda)
+            _SDA1;
+        else
+            _SDA0;
+        _as_phase(_timing.low);
+        _as_state = _AS_HIGH;
+        break;
+    case _AS_HIGH:
+        _SCL1;
+        _as_phase(_timing.high);
+        _as_state = _AS_SAMPLE;
+        break;
+    case _AS_SAMPLE:
+        sda = _SDAX;
+        _as_wait = 0;
+        _as_state = _AS_LOW;
+        if (_as_bit < 8)
+        {
+            _as_byte = (_as_byte << 1) | ((_as_stage == _AS_READ) ? sda : 0);
+            ++_as_bit;
+        }
+        else if (_as_stage == _AS_READ)
+        {
+            x->rbuf[_as_index++] = _as_byte;
+            ++x->done;
+            if (_as_index == x->rlen)
+                _as_state = _AS_STOP_LOW;
+            else
+                _as_load(x);
+        }
+        else if (sda)
+        {
+            // NACK
+            x->status = I2C_ASYNC_NACK;
+            _as_state = _AS_STOP_LOW;
+        }
+        else if (_as_stage == _AS_ADDR_W)
+        {
+            if (x->wlen)
+            {
+                _as_stage = _AS_WRITE;
+                _as_load(x);
+            }
+            else
+            {
+                _as_state = _AS_STOP_LOW;
+            }
+        }
+        else if (_as_stage == _AS_WRITE)
+        {
+            ++x->done;
+            if (++_as_index < x->wlen)
+                _as_load(x);
+            else if (x->rlen)
+                _as_state = _AS_RESTART_LOW;
+            else
+                _as_state = _AS_STOP_LOW;
+        }
+        else
+        {
+            // Read address ACK'ed
+            _as_stage = _AS_READ;
+            _as_index = 0;
+            _as_load(x);
+        }
+        break;
+    case _AS_RESTART_LOW:
+        _SCL0;
+        _SDA1;
+        _as_phase(_timing.low);
+        _as_state = _AS_RESTART_HIGH;
+        break;
+    case _AS_RESTART_HIGH:
+        _SCL1;
+        _as_phase(_timing.su_sta);
+        _as_state = _AS_START;
+        break;
+    case _AS_START:
+        _SDA0;
+        _as_phase(_timing.hd_sta);
+        _as_stage = _AS_ADDR_R;
+        _as_load(x);
+        _as_state = _AS_LOW;
+        break;
+    case _AS_STOP_LOW:
+        _SCL0;
+        _SDA0;
+        _as_phase(_timing.low);
+        _as_state = _AS_STOP_HIGH;
+        break;
+    case _AS_STOP_HIGH:
+        _SCL1;
+        _as_phase(_timing.su_sto);
+        _as_state = _AS_STOP;
+        break;
+    case _AS_STOP:
+        _SDA1;
+        _as_phase(_timing.buf);
+        _edge = _as_edge;   // For tBUF in the single lane functions
+        _as_state = _AS_IDLE;
+        if (x->status == I2C_ASYNC_BUSY)
+            x->status = I2C_ASYNC_OK;
+        _as_head = x->next;
+        if (_as_head == NULL)
+            _as_tail = NULL;
+        if (x->cb)
+            x->cb(x, x->arg);
+        break;
+    }
+    return true;
+}
+
+
+/**
+ * @brief   Timer tick, runs a burst of bus phases. Stops the timer when the queue runs dry.
+ */
+LOCAL void _as_tick(void *arg)
+{
+    uint8_t n;
+
+    RTC_CLR_REG_MASK(FRC1_INT_ADDRESS, FRC1_INT_CLR_MASK);
+    for (n = 0; n < _as_phases; ++n)
+    {
+        if (!_as_step())
+        {
+            RTC_REG_WRITE(FRC1_CTRL_ADDRESS, 0);
+            _as_running = false;
+            break;
+        }
+    }
+}
+
+
+LOCAL void _as_arm(void)
+{
+    _xt_isr_attach(ETS_FRC_TIMER1_INUM, _as_tick, NULL);
+    TM1_EDGE_INT_ENABLE();
+    RTC_REG_WRITE(FRC1_LOAD_ADDRESS, _FRC1_TICKS(_as_tick_us));
+    RTC_REG_WRITE(FRC1_CTRL_ADDRESS, _FRC1_DIV_16 | _FRC1_AUTO_LOAD | _FRC1_ENABLE_TIMER);
+    _as_running = true;
+}
+
+
+void ICACHE_FLASH_ATTR i2c_async_config(uint16_t tick_us, uint8_t phases)
+{
+    _as_tick_us = tick_us;
+    _as_phases = phases ? phases : 1;
+    if (_as_running)
+        RTC_REG_WRITE(FRC1_LOAD_ADDRESS, _FRC1_TICKS(_as_tick_us));
+}
+
+
+void ICACHE_FLASH_ATTR i2c_async_submit(i2c_async_xfer_t *xfer)
+{
+    xfer->next = NULL;
+    xfer->status = I2C_ASYNC_PENDING;
+    xfer->done = 0;
+    _xt_isr_mask(1 << ETS_FRC_TIMER1_INUM);
+    if (_as_tail)
+        _as_tail->next = xfer;
+    else
+        _as_head = xfer;
+    _as_tail = xfer;
+    if (!_as_running)
+    {
+        // Engine was idle, single lane functions may have moved the bus since
+        _as_edge = _edge;
+        _as_wait = 0;
+        _as_arm();
+    }
+    _xt_isr_unmask(1 << ETS_FRC_TIMER1_INUM);
+}
+
+
+bool ICACHE_FLASH_ATTR i2c_async_busy(void)
+{
+    return (_as_head != NULL);
+}
@@ -0,0 +1,269 @@
+/**
+  ******************************************************************************
+  * @file    i2c_bus.c
+  * @author  Baoshi <mail(at)ba0sh1(dot)com>
+  * @version 0.1
+  * @date    Dec 24, 2014
+  * @brief   Shared I2C bus manager. Tasks hand transactions over through a
+  *          queue and block until the manager task has run them. Transactions
+  *          that arrive while the bus is in use wait in a list sorted by
+  *          priority, so a short UI update goes ahead of a bulk transfer that
+  *          is still waiting.
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Copyright (c) 2015, Baoshi Zhu. All rights reserved.
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#include "esp_common.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "dmsg.h"
+#include "i2c.h"
+#include "i2c_bus.h"
+
+
+/**
+ * @name User configurable bus manager option block
+ * @{
+ */
+
+//! @brief Bus manager task priority. Keep it below the tasks using the bus, so they can queue new
+//!        transactions while a long one is on the bus.
+#define I2C_BUS_TASK_PRIO (tskIDLE_PRIORITY + 1)
+//! @brief Number of tasks that can wait on the bus at the same time. More callers block until one
+//!        of them is done.
+#define I2C_BUS_CLIENTS 4
+/** @} */
+
+
+//! @brief Transaction handed to the manager task, lives on the caller's stack
+typedef struct _i2c_bus_req
+{
+    struct _i2c_bus_req *next;  // Link in waiting list
+    uint8_t prio;
+    uint8_t lane;
+    const i2c_bus_seg_t *segs;
+    uint8_t count;
+    i2c_bus_fn_t fn;            // Run instead of segs if not NULL
+    void *arg;
+    bool ok;                    // Result
+    xSemaphoreHandle done;      // Given when finished
+} i2c_bus_req;
+
+LOCAL xQueueHandle _queue = NULL;       // New requests
+LOCAL xQueueHandle _done_pool = NULL;   // Free completion semaphores
+LOCAL i2c_bus_req *_waiting = NULL;     // Requests not yet run, highest priority first
+
+
+/**
+ * @brief   Put transaction segments on the bus
+ * @return  true if all bytes were transferred
+ */
+LOCAL bool ICACHE_FLASH_ATTR _execute(uint8_t lane, const i2c_bus_seg_t *segs, uint8_t count)
+{
+    const i2c_bus_seg_t *s;
+    bool open = false, ok = true;
+    uint8_t i;
+    uint16_t n;
+
+    i2c_select_lane(lane);
+    for (i = 0; (i < count) && ok; ++i)
+    {
+        s = segs + i;
+        if (!open || !(s->flags & I2C_SEG_CONTINUE))
+        {
+            if (!i2c_start())
+            {
+                ok = false;     // Bus busy
+                break;
+            }
+            open = true;
+            if (!i2c_write(s->address | ((s->flags & I2C_SEG_READ) ? 0x01 : 0x00)))
+            {
+                ok = false;
+                break;
+            }
+        }
+        if (s->flags & I2C_SEG_READ)
+            n = i2c_read_buf(s->rbuf, s->len);
+        else
+            n = i2c_write_buf(s->wbuf, s->len);
+        ok = (n == s->len);
+    }
+    if (open)
+        i2c_stop();
+    return ok;
+}
+
+
+LOCAL void ICACHE_FLASH_ATTR _run(i2c_bus_req *r)
+{
+    // Let the asynchronous engine finish with the bus first
+    while (i2c_async_busy())
+        vTaskDelay(1);
+    if (r->fn)
+    {
+        r->fn(r->arg);
+        r->ok = true;
+    }
+    else
+    {
+        r->ok = _execute(r->lane, r->segs, r->count);
+    }
+}
+
+
+//! @brief Insert request into waiting list, behind all requests of the same or higher priority
+LOCAL void ICACHE_FLASH_ATTR _insert(i2c_bus_req *r)
+{
+    i2c_bus_req **p = &_waiting;
+
+    while (*p && ((*p)->prio >= r->prio))
+        p = &(*p)->next;
+    r->next = *p;
+    *p = r;
+}
+
+
+LOCAL void ICACHE_FLASH_ATTR _bus_task(void *pvParameters)
+{
+    i2c_bus_req *r;
+
+    for (;;)
+    {
+        // Sleep until there is work, then collect everything queued while the last transaction ran
+        if ((_waiting == NULL) && xQueueReceive(_queue, &r, portMAX_DELAY))
+            _insert(r);
+        while (xQueueReceive(_queue, &r, 0))
+            _insert(r);
+        r = _waiting;
+        if (r == NULL)
+            continue;
+        _waiting = r->next;
+        _run(r);
+        xSemaphoreGive(r->done);
+    }
+    vTaskDelete(NULL);
+}
+
+
+/**
+ * @brief   Hand request to manager task and wait for it, or run it here if the manager is not started
+ */
+LOCAL bool ICACHE_FLASH_ATTR _submit(i2c_bus_req *r)
+{
+    if (_queue == NULL)
+    {
+        _run(r);
+        return r->ok;
+    }
+    xQueueReceive(_done_pool, &r->done, portMAX_DELAY);
+    xQueueSend(_queue, &r, portMAX_DELAY);
+    xSemaphoreTake(r->done, portMAX_DELAY);
+    xQueueSend(_done_pool, &r->done, portMAX_DELAY);
+    return r->ok;
+}
+
+
+bool ICACHE_FLASH_ATTR i2c_bus_init(void)
+{
+    xSemaphoreHandle done;
+    uint8_t i;
+
+    if (_queue)
+        return true;
+    _done_pool = xQueueCreate(I2C_BUS_CLIENTS, sizeof(xSemaphoreHandle));
+    if (_done_pool == NULL)
+        goto i2c_bus_init_fail;
+    for (i = 0; i < I2C_BUS_CLIENTS; ++i)
+    {
+        vSemaphoreCreateBinary(done);
+        if (done == NULL)
+            goto i2c_bus_init_fail;
+        xSemaphoreTake(done, 0);    // Created given
+        xQueueSend(_done_pool, &done, 0);
+    }
+    _queue = xQueueCreate(I2C_BUS_CLIENTS, sizeof(i2c_bus_req *));
+    if (_queue == NULL)
+        goto i2c_bus_init_fail;
+    if (xTaskCreate(_bus_task, "i2c", 256, NULL, I2C_BUS_TASK_PRIO, NULL) != pdPASS)
+    {
+        vQueueDelete(_queue);
+        _queue = NULL;
+        goto i2c_bus_init_fail;
+    }
+    return true;
+
+i2c_bus_init_fail:
+    if (_done_pool)
+    {
+        // Every semaphore created so far is in the pool
+        while (xQueueReceive(_done_pool, &done, 0))
+            vSemaphoreDelete(done);
+        vQueueDelete(_done_pool);
+        _done_pool = NULL;
+    }
+    dmsg_err_puts("Start I2C bus manager failed.");
+    return false;
+}
+
+
+bool ICACHE_FLASH_ATTR i2c_bus_transfer(uint8_t lane, i2c_bus_prio_t prio, const i2c_bus_seg_t *segs, uint8_t count)
+{
+    i2c_bus_req r;
+
+    memset(&r, 0, sizeof(r));
+    r.prio = prio;
+    r.lane = lane;
+    r.segs = segs;
+    r.count = count;
+    return _submit(&r);
+}
+
+
+bool ICACHE_FLASH_ATTR i2c_bus_write_read(i2c_bus_prio_t prio, uint8_t address, const uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    i2c_bus_seg_t segs[2];
+    uint8_t n = 0;
+
+    memset(segs, 0, sizeof(segs));
+    if (wlen)
+    {
+        segs[n].flags = I2C_SEG_WRITE;
+        segs[n].address = address;
+        segs[n].len = wlen;
+        segs[n].wbuf = wbuf;
+        ++n;
+    }
+    if (rlen)
+    {
+        segs[n].flags = I2C_SEG_READ;
+        segs[n].address = address;
+        segs[n].len = rlen;
+        segs[n].rbuf = rbuf;
+        ++n;
+    }
+    return i2c_bus_transfer(0, prio, segs, n);
+}
+
+
+void ICACHE_FLASH_ATTR i2c_bus_run(i2c_bus_prio_t prio, i2c_bus_fn_t fn, void *arg)
+{
+    i2c_bus_req r;
+
+    memset(&r, 0, sizeof(r));
+    r.prio = prio;
+    r.fn = fn;
+    r.arg = arg;
+    _submit(&r);
+}
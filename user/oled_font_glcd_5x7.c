@@ -1,2591 +1,2781 @@
-/* * oled_font_glcd_5x7.c
+/*
+ * oled_font_glcd_5x7.c
  *
- * Created on: Jan 5, 2015
- *     Author: Baoshi
+ * Generated by tools/fontc from glcd_5x7.bdf, do not edit.
+ *   fontc -l page -i oled_fonts.h -d -n glcd_5x7 -t "glcd 5x7" -r 0-255 -o oled_font_glcd_5x7.c fonts/glcd_5x7.bdf
  */
-
 #include "esp_common.h"
 #include "oled_fonts.h"
 
-/* Standard ASCII 5x7 font */
-const uint8_t glcd_5x7_bitmaps[] = 
+/*
+**  Font data for glcd 5x7
+*/
+
+/* Character bitmaps for glcd 5x7, page-aligned: each byte holds 8 rows of a column, LSB on top */
+const uint8_t glcd_5x7_bitmaps[] =
 {
     /* @0 '\x0' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-
-    /* @7 '\x1' (5 pixels wide) */
-    0x70, //  ### 
-    0xF8, // #####
-    0xA8, // # # #
-    0xF8, // #####
-    0xD8, // ## ##
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @14 '\x2' (5 pixels wide) */
-    0x70, //  ### 
-    0xF8, // #####
-    0xA8, // # # #
-    0xF8, // #####
-    0x88, // #   #
-    0xD8, // ## ##
-    0x70, //  ### 
-
-    /* @21 '\x3' (5 pixels wide) */
-    0x00, //      
-    0x50, //  # # 
-    0xF8, // #####
-    0xF8, // #####
-    0xF8, // #####
-    0x70, //  ### 
-    0x20, //   #  
-
-    /* @28 '\x4' (5 pixels wide) */
-    0x00, //      
-    0x20, //   #  
-    0x70, //  ### 
-    0xF8, // #####
-    0xF8, // #####
-    0x70, //  ### 
-    0x20, //   #  
-
-    /* @35 '\x5' (5 pixels wide) */
-    0x70, //  ### 
-    0x50, //  # # 
-    0xF8, // #####
-    0xA8, // # # #
-    0xF8, // #####
-    0x20, //   #  
-    0x70, //  ### 
-
-    /* @42 '\x6' (5 pixels wide) */
-    0x20, //   #  
-    0x70, //  ### 
-    0xF8, // #####
-    0xF8, // #####
-    0xF8, // #####
-    0x20, //   #  
-    0x70, //  ### 
-
-    /* @49 '\x7' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x20, //   #  
-    0x70, //  ### 
-    0x70, //  ### 
-    0x20, //   #  
-    0x00, //      
-
-    /* @56 '\x8' (5 pixels wide) */
-    0xF8, // #####
-    0xF8, // #####
-    0xD8, // ## ##
-    0x88, // #   #
-    0x88, // #   #
-    0xD8, // ## ##
-    0xF8, // #####
-
-    /* @63 '\x9' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x20, //   #  
-    0x50, //  # # 
-    0x50, //  # # 
-    0x20, //   #  
-    0x00, //      
-
-    /* @70 '\xA' (5 pixels wide) */
-    0xF8, // #####
-    0xF8, // #####
-    0xD8, // ## ##
-    0xA8, // # # #
-    0xA8, // # # #
-    0xD8, // ## ##
-    0xF8, // #####
-
-    /* @77 '\xB' (5 pixels wide) */
-    0x00, //      
-    0x38, //   ###
-    0x18, //    ##
-    0x68, //  ## #
-    0xA0, // # #  
-    0xA0, // # #  
-    0x40, //  #   
-
-    /* @84 '\xC' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-    0x20, //   #  
-    0xF8, // #####
-    0x20, //   #  
-
-    /* @91 '\xD' (5 pixels wide) */
-    0x78, //  ####
-    0x48, //  #  #
-    0x78, //  ####
-    0x40, //  #   
-    0x40, //  #   
-    0x40, //  #   
-    0xC0, // ##   
-
-    /* @98 '\xE' (5 pixels wide) */
-    0x78, //  ####
-    0x48, //  #  #
-    0x78, //  ####
-    0x48, //  #  #
-    0x48, //  #  #
-    0x58, //  # ##
-    0xC0, // ##   
-
-    /* @105 '\xF' (5 pixels wide) */
-    0x20, //   #  
-    0xA8, // # # #
-    0x70, //  ### 
-    0xD8, // ## ##
-    0xD8, // ## ##
-    0x70, //  ### 
-    0xA8, // # # #
-
-    /* @112 '\x10' (5 pixels wide) */
-    0x80, // #    
-    0xC0, // ##   
-    0xF0, // #### 
-    0xF8, // #####
-    0xF0, // #### 
-    0xC0, // ##   
-    0x80, // #    
-
-    /* @119 '\x11' (5 pixels wide) */
-    0x08, //     #
-    0x18, //    ##
-    0x78, //  ####
-    0xF8, // #####
-    0x78, //  ####
-    0x18, //    ##
-    0x08, //     #
-
-    /* @126 '\x12' (5 pixels wide) */
-    0x20, //   #  
-    0x70, //  ### 
-    0xA8, // # # #
-    0x20, //   #  
-    0xA8, // # # #
-    0x70, //  ### 
-    0x20, //   #  
-
-    /* @133 '\x13' (5 pixels wide) */
-    0xD8, // ## ##
-    0xD8, // ## ##
-    0xD8, // ## ##
-    0xD8, // ## ##
-    0xD8, // ## ##
-    0x00, //      
-    0xD8, // ## ##
-
-    /* @140 '\x14' (5 pixels wide) */
-    0x78, //  ####
-    0xA8, // # # #
-    0xA8, // # # #
-    0x68, //  ## #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @147 '\x15' (5 pixels wide) */
-    0x30, //   ## 
-    0x48, //  #  #
-    0x50, //  # # 
-    0x28, //   # #
-    0x10, //    # 
-    0x48, //  #  #
-    0x48, //  #  #
-
-    /* @154 '\x16' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0xF8, // #####
-
-    /* @161 '\x17' (5 pixels wide) */
-    0x20, //   #  
-    0x70, //  ### 
-    0xA8, // # # #
-    0x20, //   #  
-    0xA8, // # # #
-    0x70, //  ### 
-    0x20, //   #  
-
-    /* @168 '\x18' (5 pixels wide) */
-    0x00, //      
-    0x20, //   #  
-    0x70, //  ### 
-    0xA8, // # # #
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-
-    /* @175 '\x19' (5 pixels wide) */
-    0x00, //      
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0xA8, // # # #
-    0x70, //  ### 
-    0x20, //   #  
-
-    /* @182 '\x1A' (5 pixels wide) */
-    0x00, //      
-    0x20, //   #  
-    0x10, //    # 
-    0xF8, // #####
-    0x10, //    # 
-    0x20, //   #  
-    0x00, //      
-
-    /* @189 '\x1B' (5 pixels wide) */
-    0x00, //      
-    0x20, //   #  
-    0x40, //  #   
-    0xF8, // #####
-    0x40, //  #   
-    0x20, //   #  
-    0x00, //      
-
-    /* @196 '\x1C' (5 pixels wide) */
-    0x00, //      
-    0x80, // #    
-    0x80, // #    
-    0x80, // #    
-    0xF8, // #####
-    0x00, //      
-    0x00, //      
-
-    /* @203 '\x1D' (5 pixels wide) */
-    0x00, //      
-    0x50, //  # # 
-    0xF8, // #####
-    0xF8, // #####
-    0x50, //  # # 
-    0x00, //      
-    0x00, //      
-
-    /* @210 '\x1E' (5 pixels wide) */
-    0x00, //      
-    0x20, //   #  
-    0x20, //   #  
-    0x70, //  ### 
-    0xF8, // #####
-    0xF8, // #####
-    0x00, //      
-
-    /* @217 '\x1F' (5 pixels wide) */
-    0x00, //      
-    0xF8, // #####
-    0xF8, // #####
-    0x70, //  ### 
-    0x20, //   #  
-    0x20, //   #  
-    0x00, //      
-
-    /* @224 ' ' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-
-    /* @231 '!' (5 pixels wide) */
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x00, //      
-    0x20, //   #  
-
-    /* @238 '"' (5 pixels wide) */
-    0x50, //  # # 
-    0x50, //  # # 
-    0x50, //  # # 
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-
-    /* @245 '#' (5 pixels wide) */
-    0x50, //  # # 
-    0x50, //  # # 
-    0xF8, // #####
-    0x50, //  # # 
-    0xF8, // #####
-    0x50, //  # # 
-    0x50, //  # # 
-
-    /* @252 '$' (5 pixels wide) */
-    0x20, //   #  
-    0x78, //  ####
-    0xA0, // # #  
-    0x70, //  ### 
-    0x28, //   # #
-    0xF0, // #### 
-    0x20, //   #  
-
-    /* @259 '%' (5 pixels wide) */
-    0xC0, // ##   
-    0xC8, // ##  #
-    0x10, //    # 
-    0x20, //   #  
-    0x40, //  #   
-    0x98, // #  ##
-    0x18, //    ##
-
-    /* @266 '&' (5 pixels wide) */
-    0x40, //  #   
-    0xA0, // # #  
-    0xA0, // # #  
-    0x40, //  #   
-    0xA8, // # # #
-    0x90, // #  # 
-    0x68, //  ## #
-
-    /* @273 ''' (5 pixels wide) */
-    0x30, //   ## 
-    0x30, //   ## 
-    0x20, //   #  
-    0x40, //  #   
-    0x00, //      
-    0x00, //      
-    0x00, //      
-
-    /* @280 '(' (5 pixels wide) */
-    0x10, //    # 
-    0x20, //   #  
-    0x40, //  #   
-    0x40, //  #   
-    0x40, //  #   
-    0x20, //   #  
-    0x10, //    # 
-
-    /* @287 ')' (5 pixels wide) */
-    0x40, //  #   
-    0x20, //   #  
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x20, //   #  
-    0x40, //  #   
-
-    /* @294 '*' (5 pixels wide) */
-    0x20, //   #  
-    0xA8, // # # #
-    0x70, //  ### 
-    0xF8, // #####
-    0x70, //  ### 
-    0xA8, // # # #
-    0x20, //   #  
-
-    /* @301 '+' (5 pixels wide) */
-    0x00, //      
-    0x20, //   #  
-    0x20, //   #  
-    0xF8, // #####
-    0x20, //   #  
-    0x20, //   #  
-    0x00, //      
-
-    /* @308 ',' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x30, //   ## 
-    0x30, //   ## 
-    0x20, //   #  
-
-    /* @315 '-' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0x00, //      
-    0x00, //      
-
-    /* @322 '.' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x30, //   ## 
-    0x30, //   ## 
-
-    /* @329 '/' (5 pixels wide) */
-    0x00, //      
-    0x08, //     #
-    0x10, //    # 
-    0x20, //   #  
-    0x40, //  #   
-    0x80, // #    
-    0x00, //      
-
-    /* @336 '0' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x98, // #  ##
-    0xA8, // # # #
-    0xC8, // ##  #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @343 '1' (5 pixels wide) */
-    0x20, //   #  
-    0x60, //  ##  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x70, //  ### 
-
-    /* @350 '2' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x08, //     #
-    0x70, //  ### 
-    0x80, // #    
-    0x80, // #    
-    0xF8, // #####
-
-    /* @357 '3' (5 pixels wide) */
-    0xF8, // #####
-    0x08, //     #
-    0x10, //    # 
-    0x30, //   ## 
-    0x08, //     #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @364 '4' (5 pixels wide) */
-    0x10, //    # 
-    0x30, //   ## 
-    0x50, //  # # 
-    0x90, // #  # 
-    0xF8, // #####
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @371 '5' (5 pixels wide) */
-    0xF8, // #####
-    0x80, // #    
-    0xF0, // #### 
-    0x08, //     #
-    0x08, //     #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @378 '6' (5 pixels wide) */
-    0x38, //   ###
-    0x40, //  #   
-    0x80, // #    
-    0xF0, // #### 
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @385 '7' (5 pixels wide) */
-    0xF8, // #####
-    0x08, //     #
-    0x08, //     #
-    0x10, //    # 
-    0x20, //   #  
-    0x40, //  #   
-    0x80, // #    
-
-    /* @392 '8' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @399 '9' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x78, //  ####
-    0x08, //     #
-    0x10, //    # 
-    0xE0, // ###  
-
-    /* @406 ':' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x20, //   #  
-    0x00, //      
-    0x20, //   #  
-    0x00, //      
-    0x00, //      
-
-    /* @413 ';' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x20, //   #  
-    0x00, //      
-    0x20, //   #  
-    0x20, //   #  
-    0x40, //  #   
-
-    /* @420 '<' (5 pixels wide) */
-    0x08, //     #
-    0x10, //    # 
-    0x20, //   #  
-    0x40, //  #   
-    0x20, //   #  
-    0x10, //    # 
-    0x08, //     #
-
-    /* @427 '=' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0x00, //      
-
-    /* @434 '>' (5 pixels wide) */
-    0x40, //  #   
-    0x20, //   #  
-    0x10, //    # 
-    0x08, //     #
-    0x10, //    # 
-    0x20, //   #  
-    0x40, //  #   
-
-    /* @441 '?' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x08, //     #
-    0x30, //   ## 
-    0x20, //   #  
-    0x00, //      
-    0x20, //   #  
-
-    /* @448 '@' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0xA8, // # # #
-    0xB8, // # ###
-    0xB0, // # ## 
-    0x80, // #    
-    0x78, //  ####
-
-    /* @455 'A' (5 pixels wide) */
-    0x20, //   #  
-    0x50, //  # # 
-    0x88, // #   #
-    0x88, // #   #
-    0xF8, // #####
-    0x88, // #   #
-    0x88, // #   #
-
-    /* @462 'B' (5 pixels wide) */
-    0xF0, // #### 
-    0x88, // #   #
-    0x88, // #   #
-    0xF0, // #### 
-    0x88, // #   #
-    0x88, // #   #
-    0xF0, // #### 
-
-    /* @469 'C' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x80, // #    
-    0x80, // #    
-    0x80, // #    
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @476 'D' (5 pixels wide) */
-    0xF0, // #### 
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0xF0, // #### 
-
-    /* @483 'E' (5 pixels wide) */
-    0xF8, // #####
-    0x80, // #    
-    0x80, // #    
-    0xF0, // #### 
-    0x80, // #    
-    0x80, // #    
-    0xF8, // #####
-
-    /* @490 'F' (5 pixels wide) */
-    0xF8, // #####
-    0x80, // #    
-    0x80, // #    
-    0xF0, // #### 
-    0x80, // #    
-    0x80, // #    
-    0x80, // #    
-
-    /* @497 'G' (5 pixels wide) */
-    0x78, //  ####
-    0x88, // #   #
-    0x80, // #    
-    0x80, // #    
-    0x98, // #  ##
-    0x88, // #   #
-    0x78, //  ####
-
-    /* @504 'H' (5 pixels wide) */
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0xF8, // #####
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-
-    /* @511 'I' (5 pixels wide) */
-    0x70, //  ### 
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x70, //  ### 
-
-    /* @518 'J' (5 pixels wide) */
-    0x38, //   ###
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x90, // #  # 
-    0x60, //  ##  
-
-    /* @525 'K' (5 pixels wide) */
-    0x88, // #   #
-    0x90, // #  # 
-    0xA0, // # #  
-    0xC0, // ##   
-    0xA0, // # #  
-    0x90, // #  # 
-    0x88, // #   #
-
-    /* @532 'L' (5 pixels wide) */
-    0x80, // #    
-    0x80, // #    
-    0x80, // #    
-    0x80, // #    
-    0x80, // #    
-    0x80, // #    
-    0xF8, // #####
-
-    /* @539 'M' (5 pixels wide) */
-    0x88, // #   #
-    0xD8, // ## ##
-    0xA8, // # # #
-    0xA8, // # # #
-    0xA8, // # # #
-    0x88, // #   #
-    0x88, // #   #
-
-    /* @546 'N' (5 pixels wide) */
-    0x88, // #   #
-    0x88, // #   #
-    0xC8, // ##  #
-    0xA8, // # # #
-    0x98, // #  ##
-    0x88, // #   #
-    0x88, // #   #
-
-    /* @553 'O' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @560 'P' (5 pixels wide) */
-    0xF0, // #### 
-    0x88, // #   #
-    0x88, // #   #
-    0xF0, // #### 
-    0x80, // #    
-    0x80, // #    
-    0x80, // #    
-
-    /* @567 'Q' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0xA8, // # # #
-    0x90, // #  # 
-    0x68, //  ## #
-
-    /* @574 'R' (5 pixels wide) */
-    0xF0, // #### 
-    0x88, // #   #
-    0x88, // #   #
-    0xF0, // #### 
-    0xA0, // # #  
-    0x90, // #  # 
-    0x88, // #   #
-
-    /* @581 'S' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x80, // #    
-    0x70, //  ### 
-    0x08, //     #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @588 'T' (5 pixels wide) */
-    0xF8, // #####
-    0xA8, // # # #
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-
-    /* @595 'U' (5 pixels wide) */
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @602 'V' (5 pixels wide) */
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x50, //  # # 
-    0x20, //   #  
-
-    /* @609 'W' (5 pixels wide) */
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0xA8, // # # #
-    0xA8, // # # #
-    0xA8, // # # #
-    0x50, //  # # 
-
-    /* @616 'X' (5 pixels wide) */
-    0x88, // #   #
-    0x88, // #   #
-    0x50, //  # # 
-    0x20, //   #  
-    0x50, //  # # 
-    0x88, // #   #
-    0x88, // #   #
-
-    /* @623 'Y' (5 pixels wide) */
-    0x88, // #   #
-    0x88, // #   #
-    0x50, //  # # 
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-
-    /* @630 'Z' (5 pixels wide) */
-    0xF8, // #####
-    0x08, //     #
-    0x10, //    # 
-    0x70, //  ### 
-    0x40, //  #   
-    0x80, // #    
-    0xF8, // #####
-
-    /* @637 '[' (5 pixels wide) */
-    0x78, //  ####
-    0x40, //  #   
-    0x40, //  #   
-    0x40, //  #   
-    0x40, //  #   
-    0x40, //  #   
-    0x78, //  ####
-
-    /* @644 '\' (5 pixels wide) */
-    0x00, //      
-    0x80, // #    
-    0x40, //  #   
-    0x20, //   #  
-    0x10, //    # 
-    0x08, //     #
-    0x00, //      
-
-    /* @651 ']' (5 pixels wide) */
-    0x78, //  ####
-    0x08, //     #
-    0x08, //     #
-    0x08, //     #
-    0x08, //     #
-    0x08, //     #
-    0x78, //  ####
-
-    /* @658 '^' (5 pixels wide) */
-    0x20, //   #  
-    0x50, //  # # 
-    0x88, // #   #
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-
-    /* @665 '_' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-
-    /* @672 '`' (5 pixels wide) */
-    0x60, //  ##  
-    0x60, //  ##  
-    0x20, //   #  
-    0x10, //    # 
-    0x00, //      
-    0x00, //      
-    0x00, //      
-
-    /* @679 'a' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x60, //  ##  
-    0x10, //    # 
-    0x70, //  ### 
-    0x90, // #  # 
-    0x78, //  ####
-
-    /* @686 'b' (5 pixels wide) */
-    0x80, // #    
-    0x80, // #    
-    0xB0, // # ## 
-    0xC8, // ##  #
-    0x88, // #   #
-    0xC8, // ##  #
-    0xB0, // # ## 
-
-    /* @693 'c' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x70, //  ### 
-    0x88, // #   #
-    0x80, // #    
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @700 'd' (5 pixels wide) */
-    0x08, //     #
-    0x08, //     #
-    0x68, //  ## #
-    0x98, // #  ##
-    0x88, // #   #
-    0x98, // #  ##
-    0x68, //  ## #
-
-    /* @707 'e' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x70, //  ### 
-    0x88, // #   #
-    0xF8, // #####
-    0x80, // #    
-    0x70, //  ### 
-
-    /* @714 'f' (5 pixels wide) */
-    0x10, //    # 
-    0x28, //   # #
-    0x20, //   #  
-    0x70, //  ### 
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-
-    /* @721 'g' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x70, //  ### 
-    0x98, // #  ##
-    0x98, // #  ##
-    0x68, //  ## #
-    0x08, //     #
-
-    /* @728 'h' (5 pixels wide) */
-    0x80, // #    
-    0x80, // #    
-    0xB0, // # ## 
-    0xC8, // ##  #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-
-    /* @735 'i' (5 pixels wide) */
-    0x20, //   #  
-    0x00, //      
-    0x60, //  ##  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x70, //  ### 
-
-    /* @742 'j' (5 pixels wide) */
-    0x10, //    # 
-    0x00, //      
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x90, // #  # 
-    0x60, //  ##  
-
-    /* @749 'k' (5 pixels wide) */
-    0x80, // #    
-    0x80, // #    
-    0x90, // #  # 
-    0xA0, // # #  
-    0xC0, // ##   
-    0xA0, // # #  
-    0x90, // #  # 
-
-    /* @756 'l' (5 pixels wide) */
-    0x60, //  ##  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x70, //  ### 
-
-    /* @763 'm' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0xD0, // ## # 
-    0xA8, // # # #
-    0xA8, // # # #
-    0xA8, // # # #
-    0xA8, // # # #
-
-    /* @770 'n' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0xB0, // # ## 
-    0xC8, // ##  #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-
-    /* @777 'o' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @784 'p' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0xB0, // # ## 
-    0xC8, // ##  #
-    0xC8, // ##  #
-    0xB0, // # ## 
-    0x80, // #    
-
-    /* @791 'q' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x68, //  ## #
-    0x98, // #  ##
-    0x98, // #  ##
-    0x68, //  ## #
-    0x08, //     #
-
-    /* @798 'r' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0xB0, // # ## 
-    0xC8, // ##  #
-    0x80, // #    
-    0x80, // #    
-    0x80, // #    
-
-    /* @805 's' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x78, //  ####
-    0x80, // #    
-    0x70, //  ### 
-    0x08, //     #
-    0xF0, // #### 
-
-    /* @812 't' (5 pixels wide) */
-    0x20, //   #  
-    0x20, //   #  
-    0xF8, // #####
-    0x20, //   #  
-    0x20, //   #  
-    0x28, //   # #
-    0x10, //    # 
-
-    /* @819 'u' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x98, // #  ##
-    0x68, //  ## #
-
-    /* @826 'v' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x50, //  # # 
-    0x20, //   #  
-
-    /* @833 'w' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x88, // #   #
-    0x88, // #   #
-    0xA8, // # # #
-    0xA8, // # # #
-    0x50, //  # # 
-
-    /* @840 'x' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x88, // #   #
-    0x50, //  # # 
-    0x20, //   #  
-    0x50, //  # # 
-    0x88, // #   #
-
-    /* @847 'y' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x88, // #   #
-    0x88, // #   #
-    0x78, //  ####
-    0x08, //     #
-    0x88, // #   #
-
-    /* @854 'z' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x10, //    # 
-    0x20, //   #  
-    0x40, //  #   
-    0xF8, // #####
-
-    /* @861 '{' (5 pixels wide) */
-    0x10, //    # 
-    0x20, //   #  
-    0x20, //   #  
-    0x40, //  #   
-    0x20, //   #  
-    0x20, //   #  
-    0x10, //    # 
-
-    /* @868 '|' (5 pixels wide) */
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x00, //      
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-
-    /* @875 '}' (5 pixels wide) */
-    0x40, //  #   
-    0x20, //   #  
-    0x20, //   #  
-    0x10, //    # 
-    0x20, //   #  
-    0x20, //   #  
-    0x40, //  #   
-
-    /* @882 '~' (5 pixels wide) */
-    0x40, //  #   
-    0xA8, // # # #
-    0x10, //    # 
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-
-    /* @889 '\x7F' (5 pixels wide) */
-    0x20, //   #  
-    0x70, //  ### 
-    0xD8, // ## ##
-    0x88, // #   #
-    0x88, // #   #
-    0xF8, // #####
-    0x00, //      
-
-    /* @896 '\x80' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x80, // #    
-    0x80, // #    
-    0x88, // #   #
-    0x70, //  ### 
-    0x10, //    # 
-
-    /* @903 '\x81' (5 pixels wide) */
-    0x00, //      
-    0x88, // #   #
-    0x00, //      
-    0x88, // #   #
-    0x88, // #   #
-    0x98, // #  ##
-    0x68, //  ## #
-
-    /* @910 '\x82' (5 pixels wide) */
-    0x18, //    ##
-    0x00, //      
-    0x70, //  ### 
-    0x88, // #   #
-    0xF8, // #####
-    0x80, // #    
-    0x78, //  ####
-
-    /* @917 '\x83' (5 pixels wide) */
-    0xF8, // #####
-    0x00, //      
-    0x60, //  ##  
-    0x10, //    # 
-    0x70, //  ### 
-    0x90, // #  # 
-    0x78, //  ####
-
-    /* @924 '\x84' (5 pixels wide) */
-    0x00, //      
-    0x88, // #   #
-    0x60, //  ##  
-    0x10, //    # 
-    0x70, //  ### 
-    0x90, // #  # 
-    0x78, //  ####
-
-    /* @931 '\x85' (5 pixels wide) */
-    0xC0, // ##   
-    0x00, //      
-    0x60, //  ##  
-    0x10, //    # 
-    0x70, //  ### 
-    0x90, // #  # 
-    0x78, //  ####
-
-    /* @938 '\x86' (5 pixels wide) */
-    0x30, //   ## 
-    0x00, //      
-    0x60, //  ##  
-    0x10, //    # 
-    0x70, //  ### 
-    0x90, // #  # 
-    0x78, //  ####
-
-    /* @945 '\x87' (5 pixels wide) */
-    0x00, //      
-    0x78, //  ####
-    0xC0, // ##   
-    0xC0, // ##   
-    0x78, //  ####
-    0x10, //    # 
-    0x30, //   ## 
-
-    /* @952 '\x88' (5 pixels wide) */
-    0xF8, // #####
-    0x00, //      
-    0x70, //  ### 
-    0x88, // #   #
-    0xF8, // #####
-    0x80, // #    
-    0x78, //  ####
-
-    /* @959 '\x89' (5 pixels wide) */
-    0x88, // #   #
-    0x00, //      
-    0x70, //  ### 
-    0x88, // #   #
-    0xF8, // #####
-    0x80, // #    
-    0x78, //  ####
-
-    /* @966 '\x8A' (5 pixels wide) */
-    0xC0, // ##   
-    0x00, //      
-    0x70, //  ### 
-    0x88, // #   #
-    0xF8, // #####
-    0x80, // #    
-    0x78, //  ####
-
-    /* @973 '\x8B' (5 pixels wide) */
-    0x28, //   # #
-    0x00, //      
-    0x30, //   ## 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x38, //   ###
-
-    /* @980 '\x8C' (5 pixels wide) */
-    0x30, //   ## 
-    0x48, //  #  #
-    0x30, //   ## 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x38, //   ###
-
-    /* @987 '\x8D' (5 pixels wide) */
-    0x60, //  ##  
-    0x00, //      
-    0x30, //   ## 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x38, //   ###
-
-    /* @994 '\x8E' (5 pixels wide) */
-    0xA8, // # # #
-    0x50, //  # # 
-    0x88, // #   #
-    0x88, // #   #
-    0xF8, // #####
-    0x88, // #   #
-    0x88, // #   #
-
-    /* @1001 '\x8F' (5 pixels wide) */
-    0x20, //   #  
-    0x00, //      
-    0x20, //   #  
-    0x50, //  # # 
-    0x88, // #   #
-    0xF8, // #####
-    0x88, // #   #
-
-    /* @1008 '\x90' (5 pixels wide) */
-    0x30, //   ## 
-    0x00, //      
-    0xF0, // #### 
-    0x80, // #    
-    0xE0, // ###  
-    0x80, // #    
-    0xF0, // #### 
-
-    /* @1015 '\x91' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x78, //  ####
-    0x10, //    # 
-    0x78, //  ####
-    0x90, // #  # 
-    0x78, //  ####
-
-    /* @1022 '\x92' (5 pixels wide) */
-    0x38, //   ###
-    0x50, //  # # 
-    0x90, // #  # 
-    0xF8, // #####
-    0x90, // #  # 
-    0x90, // #  # 
-    0x98, // #  ##
-
-    /* @1029 '\x93' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x00, //      
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @1036 '\x94' (5 pixels wide) */
-    0x00, //      
-    0x88, // #   #
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @1043 '\x95' (5 pixels wide) */
-    0x00, //      
-    0xC0, // ##   
-    0x00, //      
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @1050 '\x96' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x00, //      
-    0x88, // #   #
-    0x88, // #   #
-    0x98, // #  ##
-    0x68, //  ## #
-
-    /* @1057 '\x97' (5 pixels wide) */
-    0x00, //      
-    0xC0, // ##   
-    0x00, //      
-    0x88, // #   #
-    0x88, // #   #
-    0x98, // #  ##
-    0x68, //  ## #
-
-    /* @1064 '\x98' (5 pixels wide) */
-    0x48, //  #  #
-    0x00, //      
-    0x48, //  #  #
-    0x48, //  #  #
-    0x48, //  #  #
-    0x38, //   ###
-    0x08, //     #
-
-    /* @1071 '\x99' (5 pixels wide) */
-    0x88, // #   #
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @1078 '\x9A' (5 pixels wide) */
-    0x88, // #   #
-    0x00, //      
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @1085 '\x9B' (5 pixels wide) */
-    0x20, //   #  
-    0x20, //   #  
-    0xF8, // #####
-    0xA0, // # #  
-    0xA0, // # #  
-    0xF8, // #####
-    0x20, //   #  
-
-    /* @1092 '\x9C' (5 pixels wide) */
-    0x30, //   ## 
-    0x58, //  # ##
-    0x48, //  #  #
-    0xE0, // ###  
-    0x40, //  #   
-    0x48, //  #  #
-    0xF8, // #####
-
-    /* @1099 '\x9D' (5 pixels wide) */
-    0xD8, // ## ##
-    0xD8, // ## ##
-    0x70, //  ### 
-    0xF8, // #####
-    0x20, //   #  
-    0xF8, // #####
-    0x20, //   #  
-
-    /* @1106 '\x9E' (5 pixels wide) */
-    0xE0, // ###  
-    0x90, // #  # 
-    0x90, // #  # 
-    0xE0, // ###  
-    0x90, // #  # 
-    0xB8, // # ###
-    0x90, // #  # 
-
-    /* @1113 '\x9F' (5 pixels wide) */
-    0x18, //    ##
-    0x28, //   # #
-    0x20, //   #  
-    0x70, //  ### 
-    0x20, //   #  
-    0x20, //   #  
-    0xA0, // # #  
-
-    /* @1120 '\xA0' (5 pixels wide) */
-    0x18, //    ##
-    0x00, //      
-    0x60, //  ##  
-    0x10, //    # 
-    0x70, //  ### 
-    0x90, // #  # 
-    0x78, //  ####
-
-    /* @1127 '\xA1' (5 pixels wide) */
-    0x18, //    ##
-    0x00, //      
-    0x30, //   ## 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x38, //   ###
-
-    /* @1134 '\xA2' (5 pixels wide) */
-    0x00, //      
-    0x18, //    ##
-    0x00, //      
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @1141 '\xA3' (5 pixels wide) */
-    0x00, //      
-    0x18, //    ##
-    0x00, //      
-    0x88, // #   #
-    0x88, // #   #
-    0x98, // #  ##
-    0x68, //  ## #
-
-    /* @1148 '\xA4' (5 pixels wide) */
-    0x00, //      
-    0x78, //  ####
-    0x00, //      
-    0x70, //  ### 
-    0x48, //  #  #
-    0x48, //  #  #
-    0x48, //  #  #
-
-    /* @1155 '\xA5' (5 pixels wide) */
-    0xF8, // #####
-    0x00, //      
-    0xC8, // ##  #
-    0xE8, // ### #
-    0xB8, // # ###
-    0x98, // #  ##
-    0x88, // #   #
-
-    /* @1162 '\xA6' (5 pixels wide) */
-    0x70, //  ### 
-    0x90, // #  # 
-    0x90, // #  # 
-    0x78, //  ####
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-
-    /* @1169 '\xA7' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-
-    /* @1176 '\xA8' (5 pixels wide) */
-    0x20, //   #  
-    0x00, //      
-    0x20, //   #  
-    0x60, //  ##  
-    0x80, // #    
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @1183 '\xA9' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x80, // #    
-    0x80, // #    
-    0x00, //      
-
-    /* @1190 '\xAA' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x08, //     #
-    0x08, //     #
-    0x00, //      
-
-    /* @1197 '\xAB' (5 pixels wide) */
-    0x80, // #    
-    0x88, // #   #
-    0x90, // #  # 
-    0xB8, // # ###
-    0x48, //  #  #
-    0x98, // #  ##
-    0x20, //   #  
-
-    /* @1204 '\xAC' (5 pixels wide) */
-    0x80, // #    
-    0x88, // #   #
-    0x90, // #  # 
-    0xA8, // # # #
-    0x58, //  # ##
-    0xB8, // # ###
-    0x08, //     #
-
-    /* @1211 '\xAD' (5 pixels wide) */
-    0x20, //   #  
-    0x20, //   #  
-    0x00, //      
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-
-    /* @1218 '\xAE' (5 pixels wide) */
-    0x00, //      
-    0x28, //   # #
-    0x50, //  # # 
-    0xA0, // # #  
-    0x50, //  # # 
-    0x28, //   # #
-    0x00, //      
-
-    /* @1225 '\xAF' (5 pixels wide) */
-    0x00, //      
-    0xA0, // # #  
-    0x50, //  # # 
-    0x28, //   # #
-    0x50, //  # # 
-    0xA0, // # #  
-    0x00, //      
-
-    /* @1232 '\xB0' (5 pixels wide) */
-    0x20, //   #  
-    0x88, // #   #
-    0x20, //   #  
-    0x88, // #   #
-    0x20, //   #  
-    0x88, // #   #
-    0x20, //   #  
-
-    /* @1239 '\xB1' (5 pixels wide) */
-    0x50, //  # # 
-    0xA8, // # # #
-    0x50, //  # # 
-    0xA8, // # # #
-    0x50, //  # # 
-    0xA8, // # # #
-    0x50, //  # # 
-
-    /* @1246 '\xB2' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1253 '\xB3' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0xF0, // #### 
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1260 '\xB4' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0xF0, // #### 
-    0x10, //    # 
-    0xF0, // #### 
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1267 '\xB5' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0xE8, // ### #
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1274 '\xB6' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1281 '\xB7' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0xF0, // #### 
-    0x10, //    # 
-    0xF0, // #### 
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1288 '\xB8' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0xE8, // ### #
-    0x08, //     #
-    0xE8, // ### #
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1295 '\xB9' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1302 '\xBA' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x08, //     #
-    0xE8, // ### #
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1309 '\xBB' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0xE8, // ### #
-    0x08, //     #
-    0xF8, // #####
-    0x00, //      
-    0x00, //      
-
-    /* @1316 '\xBC' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0xF8, // #####
-    0x00, //      
-    0x00, //      
-
-    /* @1323 '\xBD' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0xF0, // #### 
-    0x10, //    # 
-    0xF0, // #### 
-    0x00, //      
-    0x00, //      
-
-    /* @1330 '\xBE' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0xF0, // #### 
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1337 '\xBF' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x18, //    ##
-    0x00, //      
-    0x00, //      
-
-    /* @1344 '\xC0' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0xF8, // #####
-    0x00, //      
-    0x00, //      
-
-    /* @1351 '\xC1' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1358 '\xC2' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x18, //    ##
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1365 '\xC3' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0x00, //      
-
-    /* @1372 '\xC4' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0xF8, // #####
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1379 '\xC5' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0x18, //    ##
-    0x10, //    # 
-    0x18, //    ##
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1386 '\xC6' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1393 '\xC7' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x20, //   #  
-    0x38, //   ###
-    0x00, //      
-    0x00, //      
-
-    /* @1400 '\xC8' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x38, //   ###
-    0x20, //   #  
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1407 '\xC9' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0xE8, // ### #
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0x00, //      
-
-    /* @1414 '\xCA' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0xE8, // ### #
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1421 '\xCB' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x20, //   #  
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1428 '\xCC' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0x00, //      
-
-    /* @1435 '\xCD' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0xE8, // ### #
-    0x00, //      
-    0xE8, // ### #
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1442 '\xCE' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0xF8, // #####
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0x00, //      
-
-    /* @1449 '\xCF' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0xF8, // #####
-    0x00, //      
-    0x00, //      
-
-    /* @1456 '\xD0' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0xF8, // #####
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1463 '\xD1' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1470 '\xD2' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x38, //   ###
-    0x00, //      
-    0x00, //      
-
-    /* @1477 '\xD3' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0x18, //    ##
-    0x10, //    # 
-    0x18, //    ##
-    0x00, //      
-    0x00, //      
-
-    /* @1484 '\xD4' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x18, //    ##
-    0x10, //    # 
-    0x18, //    ##
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1491 '\xD5' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x38, //   ###
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1498 '\xD6' (5 pixels wide) */
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0x28, //   # #
-    0xF8, // #####
-    0x28, //   # #
-    0x28, //   # #
-
-    /* @1505 '\xD7' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0xF8, // #####
-    0x10, //    # 
-    0xF8, // #####
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1512 '\xD8' (5 pixels wide) */
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0x10, //    # 
-    0xF0, // #### 
-    0x00, //      
-    0x00, //      
-
-    /* @1519 '\xD9' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x18, //    ##
-    0x10, //    # 
-    0x10, //    # 
-
-    /* @1526 '\xDA' (5 pixels wide) */
-    0xF8, // #####
-    0xF8, // #####
-    0xF8, // #####
-    0xF8, // #####
-    0xF8, // #####
-    0xF8, // #####
-    0xF8, // #####
-
-    /* @1533 '\xDB' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0xF8, // #####
-    0xF8, // #####
-    0xF8, // #####
-
-    /* @1540 '\xDC' (5 pixels wide) */
-    0xE0, // ###  
-    0xE0, // ###  
-    0xE0, // ###  
-    0xE0, // ###  
-    0xE0, // ###  
-    0xE0, // ###  
-    0xE0, // ###  
-
-    /* @1547 '\xDD' (5 pixels wide) */
-    0x18, //    ##
-    0x18, //    ##
-    0x18, //    ##
-    0x18, //    ##
-    0x18, //    ##
-    0x18, //    ##
-    0x18, //    ##
-
-    /* @1554 '\xDE' (5 pixels wide) */
-    0xF8, // #####
-    0xF8, // #####
-    0xF8, // #####
-    0xF8, // #####
-    0x00, //      
-    0x00, //      
-    0x00, //      
-
-    /* @1561 '\xDF' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x68, //  ## #
-    0x90, // #  # 
-    0x90, // #  # 
-    0x90, // #  # 
-    0x68, //  ## #
-
-    /* @1568 '\xE0' (5 pixels wide) */
-    0x00, //      
-    0x70, //  ### 
-    0x88, // #   #
-    0xF0, // #### 
-    0x88, // #   #
-    0x88, // #   #
-    0xF0, // #### 
-
-    /* @1575 '\xE1' (5 pixels wide) */
-    0x00, //      
-    0xF8, // #####
-    0x98, // #  ##
-    0x80, // #    
-    0x80, // #    
-    0x80, // #    
-    0x80, // #    
-
-    /* @1582 '\xE2' (5 pixels wide) */
-    0x00, //      
-    0xF8, // #####
-    0x50, //  # # 
-    0x50, //  # # 
-    0x50, //  # # 
-    0x50, //  # # 
-    0x50, //  # # 
-
-    /* @1589 '\xE3' (5 pixels wide) */
-    0xF8, // #####
-    0x88, // #   #
-    0x40, //  #   
-    0x20, //   #  
-    0x40, //  #   
-    0x88, // #   #
-    0xF8, // #####
-
-    /* @1596 '\xE4' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x78, //  ####
-    0x90, // #  # 
-    0x90, // #  # 
-    0x90, // #  # 
-    0x60, //  ##  
-
-    /* @1603 '\xE5' (5 pixels wide) */
-    0x00, //      
-    0x50, //  # # 
-    0x50, //  # # 
-    0x50, //  # # 
-    0x50, //  # # 
-    0x68, //  ## #
-    0xC0, // ##   
-
-    /* @1610 '\xE6' (5 pixels wide) */
-    0x00, //      
-    0xF8, // #####
-    0xA0, // # #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-
-    /* @1617 '\xE7' (5 pixels wide) */
-    0xF8, // #####
-    0x20, //   #  
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-    0x20, //   #  
-
-    /* @1624 '\xE8' (5 pixels wide) */
-    0x20, //   #  
-    0x50, //  # # 
-    0x88, // #   #
-    0xF8, // #####
-    0x88, // #   #
-    0x50, //  # # 
-    0x20, //   #  
-
-    /* @1631 '\xE9' (5 pixels wide) */
-    0x20, //   #  
-    0x50, //  # # 
-    0x88, // #   #
-    0x88, // #   #
-    0x50, //  # # 
-    0x50, //  # # 
-    0xD8, // ## ##
-
-    /* @1638 '\xEA' (5 pixels wide) */
-    0x30, //   ## 
-    0x40, //  #   
-    0x30, //   ## 
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x70, //  ### 
-
-    /* @1645 '\xEB' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x70, //  ### 
-    0xA8, // # # #
-    0xA8, // # # #
-    0x70, //  ### 
-
-    /* @1652 '\xEC' (5 pixels wide) */
-    0x08, //     #
-    0x70, //  ### 
-    0x98, // #  ##
-    0xA8, // # # #
-    0xA8, // # # #
-    0xC8, // ##  #
-    0x70, //  ### 
-
-    /* @1659 '\xED' (5 pixels wide) */
-    0x70, //  ### 
-    0x80, // #    
-    0x80, // #    
-    0xF0, // #### 
-    0x80, // #    
-    0x80, // #    
-    0x70, //  ### 
-
-    /* @1666 '\xEE' (5 pixels wide) */
-    0x70, //  ### 
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-    0x88, // #   #
-
-    /* @1673 '\xEF' (5 pixels wide) */
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-
-    /* @1680 '\xF0' (5 pixels wide) */
-    0x20, //   #  
-    0x20, //   #  
-    0xF8, // #####
-    0x20, //   #  
-    0x20, //   #  
-    0x00, //      
-    0xF8, // #####
-
-    /* @1687 '\xF1' (5 pixels wide) */
-    0x40, //  #   
-    0x20, //   #  
-    0x10, //    # 
-    0x20, //   #  
-    0x40, //  #   
-    0x00, //      
-    0xF8, // #####
-
-    /* @1694 '\xF2' (5 pixels wide) */
-    0x10, //    # 
-    0x20, //   #  
-    0x40, //  #   
-    0x20, //   #  
-    0x10, //    # 
-    0x00, //      
-    0xF8, // #####
-
-    /* @1701 '\xF3' (5 pixels wide) */
-    0x38, //   ###
-    0x28, //   # #
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-
-    /* @1708 '\xF4' (5 pixels wide) */
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0xA0, // # #  
-    0xA0, // # #  
-
-    /* @1715 '\xF5' (5 pixels wide) */
-    0x30, //   ## 
-    0x30, //   ## 
-    0x00, //      
-    0xF8, // #####
-    0x00, //      
-    0x30, //   ## 
-    0x30, //   ## 
-
-    /* @1722 '\xF6' (5 pixels wide) */
-    0x00, //      
-    0xE8, // ### #
-    0xB8, // # ###
-    0x00, //      
-    0xE8, // ### #
-    0xB8, // # ###
-    0x00, //      
-
-    /* @1729 '\xF7' (5 pixels wide) */
-    0x70, //  ### 
-    0xD8, // ## ##
-    0xD8, // ## ##
-    0x70, //  ### 
-    0x00, //      
-    0x00, //      
-    0x00, //      
-
-    /* @1736 '\xF8' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x30, //   ## 
-    0x30, //   ## 
-    0x00, //      
-    0x00, //      
-
-    /* @1743 '\xF9' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x30, //   ## 
-    0x00, //      
-    0x00, //      
-
-    /* @1750 '\xFA' (5 pixels wide) */
-    0x38, //   ###
-    0x20, //   #  
-    0x20, //   #  
-    0x20, //   #  
-    0xA0, // # #  
-    0xA0, // # #  
-    0x60, //  ##  
-
-    /* @1757 '\xFB' (5 pixels wide) */
-    0x70, //  ### 
-    0x48, //  #  #
-    0x48, //  #  #
-    0x48, //  #  #
-    0x48, //  #  #
-    0x00, //      
-    0x00, //      
-
-    /* @1764 '\xFC' (5 pixels wide) */
-    0x70, //  ### 
-    0x18, //    ##
-    0x30, //   ## 
-    0x60, //  ##  
-    0x78, //  ####
-    0x00, //      
-    0x00, //      
-
-    /* @1771 '\xFD' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x78, //  ####
-    0x78, //  ####
-    0x78, //  ####
-    0x78, //  ####
-    0x00, //      
-
-    /* @1778 '\xFE' (5 pixels wide) */
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-    0x00, //      
-
-    /* @1785 '\xFF' (5 pixels wide) */
-    0x08, //     #
-    0x28, //   # #
-    0x08, //     #
-    0x28, //   # #
-    0x00, //      
-    0x78, //  ####
-    0x08, //     #
-
+    //
+    //
+    //
+    //
+    //
+    //
+    //
+    0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* @5 '\x1' (5 pixels wide) */
+    //  ###
+    // #####
+    // # # #
+    // #####
+    // ## ##
+    // #   #
+    //  ###
+    0x3E, 0x5B, 0x4F, 0x5B, 0x3E,
+
+    /* @10 '\x2' (5 pixels wide) */
+    //  ###
+    // #####
+    // # # #
+    // #####
+    // #   #
+    // ## ##
+    //  ###
+    0x3E, 0x6B, 0x4F, 0x6B, 0x3E,
+
+    /* @15 '\x3' (5 pixels wide) */
+    //
+    //  # #
+    // #####
+    // #####
+    // #####
+    //  ###
+    //   #
+    0x1C, 0x3E, 0x7C, 0x3E, 0x1C,
+
+    /* @20 '\x4' (5 pixels wide) */
+    //
+    //   #
+    //  ###
+    // #####
+    // #####
+    //  ###
+    //   #
+    0x18, 0x3C, 0x7E, 0x3C, 0x18,
+
+    /* @25 '\x5' (5 pixels wide) */
+    //  ###
+    //  # #
+    // #####
+    // # # #
+    // #####
+    //   #
+    //  ###
+    0x1C, 0x57, 0x7D, 0x57, 0x1C,
+
+    /* @30 '\x6' (5 pixels wide) */
+    //   #
+    //  ###
+    // #####
+    // #####
+    // #####
+    //   #
+    //  ###
+    0x1C, 0x5E, 0x7F, 0x5E, 0x1C,
+
+    /* @35 '\x7' (5 pixels wide) */
+    //
+    //
+    //   #
+    //  ###
+    //  ###
+    //   #
+    //
+    0x00, 0x18, 0x3C, 0x18, 0x00,
+
+    /* @40 '\x8' (5 pixels wide) */
+    // #####
+    // #####
+    // ## ##
+    // #   #
+    // #   #
+    // ## ##
+    // #####
+    0x7F, 0x67, 0x43, 0x67, 0x7F,
+
+    /* @45 '\x9' (5 pixels wide) */
+    //
+    //
+    //   #
+    //  # #
+    //  # #
+    //   #
+    //
+    0x00, 0x18, 0x24, 0x18, 0x00,
+
+    /* @50 '\xA' (5 pixels wide) */
+    // #####
+    // #####
+    // ## ##
+    // # # #
+    // # # #
+    // ## ##
+    // #####
+    0x7F, 0x67, 0x5B, 0x67, 0x7F,
+
+    /* @55 '\xB' (5 pixels wide) */
+    //
+    //   ###
+    //    ##
+    //  ## #
+    // # #
+    // # #
+    //  #
+    0x30, 0x48, 0x3A, 0x06, 0x0E,
+
+    /* @60 '\xC' (5 pixels wide) */
+    //  ###
+    // #   #
+    // #   #
+    //  ###
+    //   #
+    // #####
+    //   #
+    0x26, 0x29, 0x79, 0x29, 0x26,
+
+    /* @65 '\xD' (5 pixels wide) */
+    //  ####
+    //  #  #
+    //  ####
+    //  #
+    //  #
+    //  #
+    // ##
+    0x40, 0x7F, 0x05, 0x05, 0x07,
+
+    /* @70 '\xE' (5 pixels wide) */
+    //  ####
+    //  #  #
+    //  ####
+    //  #  #
+    //  #  #
+    //  # ##
+    // ##
+    0x40, 0x7F, 0x05, 0x25, 0x3F,
+
+    /* @75 '\xF' (5 pixels wide) */
+    //   #
+    // # # #
+    //  ###
+    // ## ##
+    // ## ##
+    //  ###
+    // # # #
+    0x5A, 0x3C, 0x67, 0x3C, 0x5A,
+
+    /* @80 '\x10' (5 pixels wide) */
+    // #
+    // ##
+    // ####
+    // #####
+    // ####
+    // ##
+    // #
+    0x7F, 0x3E, 0x1C, 0x1C, 0x08,
+
+    /* @85 '\x11' (5 pixels wide) */
+    //     #
+    //    ##
+    //  ####
+    // #####
+    //  ####
+    //    ##
+    //     #
+    0x08, 0x1C, 0x1C, 0x3E, 0x7F,
+
+    /* @90 '\x12' (5 pixels wide) */
+    //   #
+    //  ###
+    // # # #
+    //   #
+    // # # #
+    //  ###
+    //   #
+    0x14, 0x22, 0x7F, 0x22, 0x14,
+
+    /* @95 '\x13' (5 pixels wide) */
+    // ## ##
+    // ## ##
+    // ## ##
+    // ## ##
+    // ## ##
+    //
+    // ## ##
+    0x5F, 0x5F, 0x00, 0x5F, 0x5F,
+
+    /* @100 '\x14' (5 pixels wide) */
+    //  ####
+    // # # #
+    // # # #
+    //  ## #
+    //   # #
+    //   # #
+    //   # #
+    0x06, 0x09, 0x7F, 0x01, 0x7F,
+
+    /* @105 '\x15' (5 pixels wide) */
+    //   ##
+    //  #  #
+    //  # #
+    //   # #
+    //    #
+    //  #  #
+    //  #  #
+    0x00, 0x66, 0x09, 0x15, 0x6A,
+
+    /* @110 '\x16' (5 pixels wide) */
+    //
+    //
+    //
+    //
+    //
+    // #####
+    // #####
+    0x60, 0x60, 0x60, 0x60, 0x60,
+
+    /* @115 '\x18' (5 pixels wide) */
+    //
+    //   #
+    //  ###
+    // # # #
+    //   #
+    //   #
+    //   #
+    0x08, 0x04, 0x7E, 0x04, 0x08,
+
+    /* @120 '\x19' (5 pixels wide) */
+    //
+    //   #
+    //   #
+    //   #
+    // # # #
+    //  ###
+    //   #
+    0x10, 0x20, 0x7E, 0x20, 0x10,
+
+    /* @125 '\x1A' (5 pixels wide) */
+    //
+    //   #
+    //    #
+    // #####
+    //    #
+    //   #
+    //
+    0x08, 0x08, 0x2A, 0x1C, 0x08,
+
+    /* @130 '\x1B' (5 pixels wide) */
+    //
+    //   #
+    //  #
+    // #####
+    //  #
+    //   #
+    //
+    0x08, 0x1C, 0x2A, 0x08, 0x08,
+
+    /* @135 '\x1C' (5 pixels wide) */
+    //
+    // #
+    // #
+    // #
+    // #####
+    //
+    //
+    0x1E, 0x10, 0x10, 0x10, 0x10,
+
+    /* @140 '\x1D' (5 pixels wide) */
+    //
+    //  # #
+    // #####
+    // #####
+    //  # #
+    //
+    //
+    0x0C, 0x1E, 0x0C, 0x1E, 0x0C,
+
+    /* @145 '\x1E' (5 pixels wide) */
+    //
+    //   #
+    //   #
+    //  ###
+    // #####
+    // #####
+    //
+    0x30, 0x38, 0x3E, 0x38, 0x30,
+
+    /* @150 '\x1F' (5 pixels wide) */
+    //
+    // #####
+    // #####
+    //  ###
+    //   #
+    //   #
+    //
+    0x06, 0x0E, 0x3E, 0x0E, 0x06,
+
+    /* @155 '!' (5 pixels wide) */
+    //   #
+    //   #
+    //   #
+    //   #
+    //   #
+    //
+    //   #
+    0x00, 0x00, 0x5F, 0x00, 0x00,
+
+    /* @160 '"' (5 pixels wide) */
+    //  # #
+    //  # #
+    //  # #
+    //
+    //
+    //
+    //
+    0x00, 0x07, 0x00, 0x07, 0x00,
+
+    /* @165 '#' (5 pixels wide) */
+    //  # #
+    //  # #
+    // #####
+    //  # #
+    // #####
+    //  # #
+    //  # #
+    0x14, 0x7F, 0x14, 0x7F, 0x14,
+
+    /* @170 '$' (5 pixels wide) */
+    //   #
+    //  ####
+    // # #
+    //  ###
+    //   # #
+    // ####
+    //   #
+    0x24, 0x2A, 0x7F, 0x2A, 0x12,
+
+    /* @175 '%' (5 pixels wide) */
+    // ##
+    // ##  #
+    //    #
+    //   #
+    //  #
+    // #  ##
+    //    ##
+    0x23, 0x13, 0x08, 0x64, 0x62,
+
+    /* @180 '&' (5 pixels wide) */
+    //  #
+    // # #
+    // # #
+    //  #
+    // # # #
+    // #  #
+    //  ## #
+    0x36, 0x49, 0x56, 0x20, 0x50,
+
+    /* @185 '\x27' (5 pixels wide) */
+    //   ##
+    //   ##
+    //   #
+    //  #
+    //
+    //
+    //
+    0x00, 0x08, 0x07, 0x03, 0x00,
+
+    /* @190 '(' (5 pixels wide) */
+    //    #
+    //   #
+    //  #
+    //  #
+    //  #
+    //   #
+    //    #
+    0x00, 0x1C, 0x22, 0x41, 0x00,
+
+    /* @195 ')' (5 pixels wide) */
+    //  #
+    //   #
+    //    #
+    //    #
+    //    #
+    //   #
+    //  #
+    0x00, 0x41, 0x22, 0x1C, 0x00,
+
+    /* @200 '*' (5 pixels wide) */
+    //   #
+    // # # #
+    //  ###
+    // #####
+    //  ###
+    // # # #
+    //   #
+    0x2A, 0x1C, 0x7F, 0x1C, 0x2A,
+
+    /* @205 '+' (5 pixels wide) */
+    //
+    //   #
+    //   #
+    // #####
+    //   #
+    //   #
+    //
+    0x08, 0x08, 0x3E, 0x08, 0x08,
+
+    /* @210 ',' (5 pixels wide) */
+    //
+    //
+    //
+    //
+    //   ##
+    //   ##
+    //   #
+    0x00, 0x00, 0x70, 0x30, 0x00,
+
+    /* @215 '-' (5 pixels wide) */
+    //
+    //
+    //
+    // #####
+    //
+    //
+    //
+    0x08, 0x08, 0x08, 0x08, 0x08,
+
+    /* @220 '.' (5 pixels wide) */
+    //
+    //
+    //
+    //
+    //
+    //   ##
+    //   ##
+    0x00, 0x00, 0x60, 0x60, 0x00,
+
+    /* @225 '/' (5 pixels wide) */
+    //
+    //     #
+    //    #
+    //   #
+    //  #
+    // #
+    //
+    0x20, 0x10, 0x08, 0x04, 0x02,
+
+    /* @230 '0' (5 pixels wide) */
+    //  ###
+    // #   #
+    // #  ##
+    // # # #
+    // ##  #
+    // #   #
+    //  ###
+    0x3E, 0x51, 0x49, 0x45, 0x3E,
+
+    /* @235 '1' (5 pixels wide) */
+    //   #
+    //  ##
+    //   #
+    //   #
+    //   #
+    //   #
+    //  ###
+    0x00, 0x42, 0x7F, 0x40, 0x00,
+
+    /* @240 '2' (5 pixels wide) */
+    //  ###
+    // #   #
+    //     #
+    //  ###
+    // #
+    // #
+    // #####
+    0x72, 0x49, 0x49, 0x49, 0x46,
+
+    /* @245 '3' (5 pixels wide) */
+    // #####
+    //     #
+    //    #
+    //   ##
+    //     #
+    // #   #
+    //  ###
+    0x21, 0x41, 0x49, 0x4D, 0x33,
+
+    /* @250 '4' (5 pixels wide) */
+    //    #
+    //   ##
+    //  # #
+    // #  #
+    // #####
+    //    #
+    //    #
+    0x18, 0x14, 0x12, 0x7F, 0x10,
+
+    /* @255 '5' (5 pixels wide) */
+    // #####
+    // #
+    // ####
+    //     #
+    //     #
+    // #   #
+    //  ###
+    0x27, 0x45, 0x45, 0x45, 0x39,
+
+    /* @260 '6' (5 pixels wide) */
+    //   ###
+    //  #
+    // #
+    // ####
+    // #   #
+    // #   #
+    //  ###
+    0x3C, 0x4A, 0x49, 0x49, 0x31,
+
+    /* @265 '7' (5 pixels wide) */
+    // #####
+    //     #
+    //     #
+    //    #
+    //   #
+    //  #
+    // #
+    0x41, 0x21, 0x11, 0x09, 0x07,
+
+    /* @270 '8' (5 pixels wide) */
+    //  ###
+    // #   #
+    // #   #
+    //  ###
+    // #   #
+    // #   #
+    //  ###
+    0x36, 0x49, 0x49, 0x49, 0x36,
+
+    /* @275 '9' (5 pixels wide) */
+    //  ###
+    // #   #
+    // #   #
+    //  ####
+    //     #
+    //    #
+    // ###
+    0x46, 0x49, 0x49, 0x29, 0x1E,
+
+    /* @280 ':' (5 pixels wide) */
+    //
+    //
+    //   #
+    //
+    //   #
+    //
+    //
+    0x00, 0x00, 0x14, 0x00, 0x00,
+
+    /* @285 ';' (5 pixels wide) */
+    //
+    //
+    //   #
+    //
+    //   #
+    //   #
+    //  #
+    0x00, 0x40, 0x34, 0x00, 0x00,
+
+    /* @290 '<' (5 pixels wide) */
+    //     #
+    //    #
+    //   #
+    //  #
+    //   #
+    //    #
+    //     #
+    0x00, 0x08, 0x14, 0x22, 0x41,
+
+    /* @295 '=' (5 pixels wide) */
+    //
+    //
+    // #####
+    //
+    // #####
+    //
+    //
+    0x14, 0x14, 0x14, 0x14, 0x14,
+
+    /* @300 '>' (5 pixels wide) */
+    //  #
+    //   #
+    //    #
+    //     #
+    //    #
+    //   #
+    //  #
+    0x00, 0x41, 0x22, 0x14, 0x08,
+
+    /* @305 '?' (5 pixels wide) */
+    //  ###
+    // #   #
+    //     #
+    //   ##
+    //   #
+    //
+    //   #
+    0x02, 0x01, 0x59, 0x09, 0x06,
+
+    /* @310 '@' (5 pixels wide) */
+    //  ###
+    // #   #
+    // # # #
+    // # ###
+    // # ##
+    // #
+    //  ####
+    0x3E, 0x41, 0x5D, 0x59, 0x4E,
+
+    /* @315 'A' (5 pixels wide) */
+    //   #
+    //  # #
+    // #   #
+    // #   #
+    // #####
+    // #   #
+    // #   #
+    0x7C, 0x12, 0x11, 0x12, 0x7C,
+
+    /* @320 'B' (5 pixels wide) */
+    // ####
+    // #   #
+    // #   #
+    // ####
+    // #   #
+    // #   #
+    // ####
+    0x7F, 0x49, 0x49, 0x49, 0x36,
+
+    /* @325 'C' (5 pixels wide) */
+    //  ###
+    // #   #
+    // #
+    // #
+    // #
+    // #   #
+    //  ###
+    0x3E, 0x41, 0x41, 0x41, 0x22,
+
+    /* @330 'D' (5 pixels wide) */
+    // ####
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    // ####
+    0x7F, 0x41, 0x41, 0x41, 0x3E,
+
+    /* @335 'E' (5 pixels wide) */
+    // #####
+    // #
+    // #
+    // ####
+    // #
+    // #
+    // #####
+    0x7F, 0x49, 0x49, 0x49, 0x41,
+
+    /* @340 'F' (5 pixels wide) */
+    // #####
+    // #
+    // #
+    // ####
+    // #
+    // #
+    // #
+    0x7F, 0x09, 0x09, 0x09, 0x01,
+
+    /* @345 'G' (5 pixels wide) */
+    //  ####
+    // #   #
+    // #
+    // #
+    // #  ##
+    // #   #
+    //  ####
+    0x3E, 0x41, 0x41, 0x51, 0x73,
+
+    /* @350 'H' (5 pixels wide) */
+    // #   #
+    // #   #
+    // #   #
+    // #####
+    // #   #
+    // #   #
+    // #   #
+    0x7F, 0x08, 0x08, 0x08, 0x7F,
+
+    /* @355 'I' (5 pixels wide) */
+    //  ###
+    //   #
+    //   #
+    //   #
+    //   #
+    //   #
+    //  ###
+    0x00, 0x41, 0x7F, 0x41, 0x00,
+
+    /* @360 'J' (5 pixels wide) */
+    //   ###
+    //    #
+    //    #
+    //    #
+    //    #
+    // #  #
+    //  ##
+    0x20, 0x40, 0x41, 0x3F, 0x01,
+
+    /* @365 'K' (5 pixels wide) */
+    // #   #
+    // #  #
+    // # #
+    // ##
+    // # #
+    // #  #
+    // #   #
+    0x7F, 0x08, 0x14, 0x22, 0x41,
+
+    /* @370 'L' (5 pixels wide) */
+    // #
+    // #
+    // #
+    // #
+    // #
+    // #
+    // #####
+    0x7F, 0x40, 0x40, 0x40, 0x40,
+
+    /* @375 'M' (5 pixels wide) */
+    // #   #
+    // ## ##
+    // # # #
+    // # # #
+    // # # #
+    // #   #
+    // #   #
+    0x7F, 0x02, 0x1C, 0x02, 0x7F,
+
+    /* @380 'N' (5 pixels wide) */
+    // #   #
+    // #   #
+    // ##  #
+    // # # #
+    // #  ##
+    // #   #
+    // #   #
+    0x7F, 0x04, 0x08, 0x10, 0x7F,
+
+    /* @385 'O' (5 pixels wide) */
+    //  ###
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    //  ###
+    0x3E, 0x41, 0x41, 0x41, 0x3E,
+
+    /* @390 'P' (5 pixels wide) */
+    // ####
+    // #   #
+    // #   #
+    // ####
+    // #
+    // #
+    // #
+    0x7F, 0x09, 0x09, 0x09, 0x06,
+
+    /* @395 'Q' (5 pixels wide) */
+    //  ###
+    // #   #
+    // #   #
+    // #   #
+    // # # #
+    // #  #
+    //  ## #
+    0x3E, 0x41, 0x51, 0x21, 0x5E,
+
+    /* @400 'R' (5 pixels wide) */
+    // ####
+    // #   #
+    // #   #
+    // ####
+    // # #
+    // #  #
+    // #   #
+    0x7F, 0x09, 0x19, 0x29, 0x46,
+
+    /* @405 'S' (5 pixels wide) */
+    //  ###
+    // #   #
+    // #
+    //  ###
+    //     #
+    // #   #
+    //  ###
+    0x26, 0x49, 0x49, 0x49, 0x32,
+
+    /* @410 'T' (5 pixels wide) */
+    // #####
+    // # # #
+    //   #
+    //   #
+    //   #
+    //   #
+    //   #
+    0x03, 0x01, 0x7F, 0x01, 0x03,
+
+    /* @415 'U' (5 pixels wide) */
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    //  ###
+    0x3F, 0x40, 0x40, 0x40, 0x3F,
+
+    /* @420 'V' (5 pixels wide) */
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    //  # #
+    //   #
+    0x1F, 0x20, 0x40, 0x20, 0x1F,
+
+    /* @425 'W' (5 pixels wide) */
+    // #   #
+    // #   #
+    // #   #
+    // # # #
+    // # # #
+    // # # #
+    //  # #
+    0x3F, 0x40, 0x38, 0x40, 0x3F,
+
+    /* @430 'X' (5 pixels wide) */
+    // #   #
+    // #   #
+    //  # #
+    //   #
+    //  # #
+    // #   #
+    // #   #
+    0x63, 0x14, 0x08, 0x14, 0x63,
+
+    /* @435 'Y' (5 pixels wide) */
+    // #   #
+    // #   #
+    //  # #
+    //   #
+    //   #
+    //   #
+    //   #
+    0x03, 0x04, 0x78, 0x04, 0x03,
+
+    /* @440 'Z' (5 pixels wide) */
+    // #####
+    //     #
+    //    #
+    //  ###
+    //  #
+    // #
+    // #####
+    0x61, 0x59, 0x49, 0x4D, 0x43,
+
+    /* @445 '[' (5 pixels wide) */
+    //  ####
+    //  #
+    //  #
+    //  #
+    //  #
+    //  #
+    //  ####
+    0x00, 0x7F, 0x41, 0x41, 0x41,
+
+    /* @450 '\x5C' (5 pixels wide) */
+    //
+    // #
+    //  #
+    //   #
+    //    #
+    //     #
+    //
+    0x02, 0x04, 0x08, 0x10, 0x20,
+
+    /* @455 ']' (5 pixels wide) */
+    //  ####
+    //     #
+    //     #
+    //     #
+    //     #
+    //     #
+    //  ####
+    0x00, 0x41, 0x41, 0x41, 0x7F,
+
+    /* @460 '^' (5 pixels wide) */
+    //   #
+    //  # #
+    // #   #
+    //
+    //
+    //
+    //
+    0x04, 0x02, 0x01, 0x02, 0x04,
+
+    /* @465 '_' (5 pixels wide) */
+    //
+    //
+    //
+    //
+    //
+    //
+    // #####
+    0x40, 0x40, 0x40, 0x40, 0x40,
+
+    /* @470 '`' (5 pixels wide) */
+    //  ##
+    //  ##
+    //   #
+    //    #
+    //
+    //
+    //
+    0x00, 0x03, 0x07, 0x08, 0x00,
+
+    /* @475 'a' (5 pixels wide) */
+    //
+    //
+    //  ##
+    //    #
+    //  ###
+    // #  #
+    //  ####
+    0x20, 0x54, 0x54, 0x78, 0x40,
+
+    /* @480 'b' (5 pixels wide) */
+    // #
+    // #
+    // # ##
+    // ##  #
+    // #   #
+    // ##  #
+    // # ##
+    0x7F, 0x28, 0x44, 0x44, 0x38,
+
+    /* @485 'c' (5 pixels wide) */
+    //
+    //
+    //  ###
+    // #   #
+    // #
+    // #   #
+    //  ###
+    0x38, 0x44, 0x44, 0x44, 0x28,
+
+    /* @490 'd' (5 pixels wide) */
+    //     #
+    //     #
+    //  ## #
+    // #  ##
+    // #   #
+    // #  ##
+    //  ## #
+    0x38, 0x44, 0x44, 0x28, 0x7F,
+
+    /* @495 'e' (5 pixels wide) */
+    //
+    //
+    //  ###
+    // #   #
+    // #####
+    // #
+    //  ###
+    0x38, 0x54, 0x54, 0x54, 0x18,
+
+    /* @500 'f' (5 pixels wide) */
+    //    #
+    //   # #
+    //   #
+    //  ###
+    //   #
+    //   #
+    //   #
+    0x00, 0x08, 0x7E, 0x09, 0x02,
+
+    /* @505 'g' (5 pixels wide) */
+    //
+    //
+    //  ###
+    // #  ##
+    // #  ##
+    //  ## #
+    //     #
+    0x18, 0x24, 0x24, 0x1C, 0x78,
+
+    /* @510 'h' (5 pixels wide) */
+    // #
+    // #
+    // # ##
+    // ##  #
+    // #   #
+    // #   #
+    // #   #
+    0x7F, 0x08, 0x04, 0x04, 0x78,
+
+    /* @515 'i' (5 pixels wide) */
+    //   #
+    //
+    //  ##
+    //   #
+    //   #
+    //   #
+    //  ###
+    0x00, 0x44, 0x7D, 0x40, 0x00,
+
+    /* @520 'j' (5 pixels wide) */
+    //    #
+    //
+    //    #
+    //    #
+    //    #
+    // #  #
+    //  ##
+    0x20, 0x40, 0x40, 0x3D, 0x00,
+
+    /* @525 'k' (5 pixels wide) */
+    // #
+    // #
+    // #  #
+    // # #
+    // ##
+    // # #
+    // #  #
+    0x7F, 0x10, 0x28, 0x44, 0x00,
+
+    /* @530 'l' (5 pixels wide) */
+    //  ##
+    //   #
+    //   #
+    //   #
+    //   #
+    //   #
+    //  ###
+    0x00, 0x41, 0x7F, 0x40, 0x00,
+
+    /* @535 'm' (5 pixels wide) */
+    //
+    //
+    // ## #
+    // # # #
+    // # # #
+    // # # #
+    // # # #
+    0x7C, 0x04, 0x78, 0x04, 0x78,
+
+    /* @540 'n' (5 pixels wide) */
+    //
+    //
+    // # ##
+    // ##  #
+    // #   #
+    // #   #
+    // #   #
+    0x7C, 0x08, 0x04, 0x04, 0x78,
+
+    /* @545 'o' (5 pixels wide) */
+    //
+    //
+    //  ###
+    // #   #
+    // #   #
+    // #   #
+    //  ###
+    0x38, 0x44, 0x44, 0x44, 0x38,
+
+    /* @550 'p' (5 pixels wide) */
+    //
+    //
+    // # ##
+    // ##  #
+    // ##  #
+    // # ##
+    // #
+    0x7C, 0x18, 0x24, 0x24, 0x18,
+
+    /* @555 'q' (5 pixels wide) */
+    //
+    //
+    //  ## #
+    // #  ##
+    // #  ##
+    //  ## #
+    //     #
+    0x18, 0x24, 0x24, 0x18, 0x7C,
+
+    /* @560 'r' (5 pixels wide) */
+    //
+    //
+    // # ##
+    // ##  #
+    // #
+    // #
+    // #
+    0x7C, 0x08, 0x04, 0x04, 0x08,
+
+    /* @565 's' (5 pixels wide) */
+    //
+    //
+    //  ####
+    // #
+    //  ###
+    //     #
+    // ####
+    0x48, 0x54, 0x54, 0x54, 0x24,
+
+    /* @570 't' (5 pixels wide) */
+    //   #
+    //   #
+    // #####
+    //   #
+    //   #
+    //   # #
+    //    #
+    0x04, 0x04, 0x3F, 0x44, 0x24,
+
+    /* @575 'u' (5 pixels wide) */
+    //
+    //
+    // #   #
+    // #   #
+    // #   #
+    // #  ##
+    //  ## #
+    0x3C, 0x40, 0x40, 0x20, 0x7C,
+
+    /* @580 'v' (5 pixels wide) */
+    //
+    //
+    // #   #
+    // #   #
+    // #   #
+    //  # #
+    //   #
+    0x1C, 0x20, 0x40, 0x20, 0x1C,
+
+    /* @585 'w' (5 pixels wide) */
+    //
+    //
+    // #   #
+    // #   #
+    // # # #
+    // # # #
+    //  # #
+    0x3C, 0x40, 0x30, 0x40, 0x3C,
+
+    /* @590 'x' (5 pixels wide) */
+    //
+    //
+    // #   #
+    //  # #
+    //   #
+    //  # #
+    // #   #
+    0x44, 0x28, 0x10, 0x28, 0x44,
+
+    /* @595 'y' (5 pixels wide) */
+    //
+    //
+    // #   #
+    // #   #
+    //  ####
+    //     #
+    // #   #
+    0x4C, 0x10, 0x10, 0x10, 0x7C,
+
+    /* @600 'z' (5 pixels wide) */
+    //
+    //
+    // #####
+    //    #
+    //   #
+    //  #
+    // #####
+    0x44, 0x64, 0x54, 0x4C, 0x44,
+
+    /* @605 '{' (5 pixels wide) */
+    //    #
+    //   #
+    //   #
+    //  #
+    //   #
+    //   #
+    //    #
+    0x00, 0x08, 0x36, 0x41, 0x00,
+
+    /* @610 '|' (5 pixels wide) */
+    //   #
+    //   #
+    //   #
+    //
+    //   #
+    //   #
+    //   #
+    0x00, 0x00, 0x77, 0x00, 0x00,
+
+    /* @615 '}' (5 pixels wide) */
+    //  #
+    //   #
+    //   #
+    //    #
+    //   #
+    //   #
+    //  #
+    0x00, 0x41, 0x36, 0x08, 0x00,
+
+    /* @620 '~' (5 pixels wide) */
+    //  #
+    // # # #
+    //    #
+    //
+    //
+    //
+    //
+    0x02, 0x01, 0x02, 0x04, 0x02,
+
+    /* @625 '\x7F' (5 pixels wide) */
+    //   #
+    //  ###
+    // ## ##
+    // #   #
+    // #   #
+    // #####
+    //
+    0x3C, 0x26, 0x23, 0x26, 0x3C,
+
+    /* @630 '\x80' (5 pixels wide) */
+    //  ###
+    // #   #
+    // #
+    // #
+    // #   #
+    //  ###
+    //    #
+    0x1E, 0x21, 0x21, 0x61, 0x12,
+
+    /* @635 '\x81' (5 pixels wide) */
+    //
+    // #   #
+    //
+    // #   #
+    // #   #
+    // #  ##
+    //  ## #
+    0x3A, 0x40, 0x40, 0x20, 0x7A,
+
+    /* @640 '\x82' (5 pixels wide) */
+    //    ##
+    //
+    //  ###
+    // #   #
+    // #####
+    // #
+    //  ####
+    0x38, 0x54, 0x54, 0x55, 0x59,
+
+    /* @645 '\x83' (5 pixels wide) */
+    // #####
+    //
+    //  ##
+    //    #
+    //  ###
+    // #  #
+    //  ####
+    0x21, 0x55, 0x55, 0x79, 0x41,
+
+    /* @650 '\x84' (5 pixels wide) */
+    //
+    // #   #
+    //  ##
+    //    #
+    //  ###
+    // #  #
+    //  ####
+    0x22, 0x54, 0x54, 0x78, 0x42,
+
+    /* @655 '\x85' (5 pixels wide) */
+    // ##
+    //
+    //  ##
+    //    #
+    //  ###
+    // #  #
+    //  ####
+    0x21, 0x55, 0x54, 0x78, 0x40,
+
+    /* @660 '\x86' (5 pixels wide) */
+    //   ##
+    //
+    //  ##
+    //    #
+    //  ###
+    // #  #
+    //  ####
+    0x20, 0x54, 0x55, 0x79, 0x40,
+
+    /* @665 '\x87' (5 pixels wide) */
+    //
+    //  ####
+    // ##
+    // ##
+    //  ####
+    //    #
+    //   ##
+    0x0C, 0x1E, 0x52, 0x72, 0x12,
+
+    /* @670 '\x88' (5 pixels wide) */
+    // #####
+    //
+    //  ###
+    // #   #
+    // #####
+    // #
+    //  ####
+    0x39, 0x55, 0x55, 0x55, 0x59,
+
+    /* @675 '\x89' (5 pixels wide) */
+    // #   #
+    //
+    //  ###
+    // #   #
+    // #####
+    // #
+    //  ####
+    0x39, 0x54, 0x54, 0x54, 0x59,
+
+    /* @680 '\x8A' (5 pixels wide) */
+    // ##
+    //
+    //  ###
+    // #   #
+    // #####
+    // #
+    //  ####
+    0x39, 0x55, 0x54, 0x54, 0x58,
+
+    /* @685 '\x8B' (5 pixels wide) */
+    //   # #
+    //
+    //   ##
+    //    #
+    //    #
+    //    #
+    //   ###
+    0x00, 0x00, 0x45, 0x7C, 0x41,
+
+    /* @690 '\x8C' (5 pixels wide) */
+    //   ##
+    //  #  #
+    //   ##
+    //    #
+    //    #
+    //    #
+    //   ###
+    0x00, 0x02, 0x45, 0x7D, 0x42,
+
+    /* @695 '\x8D' (5 pixels wide) */
+    //  ##
+    //
+    //   ##
+    //    #
+    //    #
+    //    #
+    //   ###
+    0x00, 0x01, 0x45, 0x7C, 0x40,
+
+    /* @700 '\x8E' (5 pixels wide) */
+    // # # #
+    //  # #
+    // #   #
+    // #   #
+    // #####
+    // #   #
+    // #   #
+    0x7D, 0x12, 0x11, 0x12, 0x7D,
+
+    /* @705 '\x8F' (5 pixels wide) */
+    //   #
+    //
+    //   #
+    //  # #
+    // #   #
+    // #####
+    // #   #
+    0x70, 0x28, 0x25, 0x28, 0x70,
+
+    /* @710 '\x90' (5 pixels wide) */
+    //   ##
+    //
+    // ####
+    // #
+    // ###
+    // #
+    // ####
+    0x7C, 0x54, 0x55, 0x45, 0x00,
+
+    /* @715 '\x91' (5 pixels wide) */
+    //
+    //
+    //  ####
+    //    #
+    //  ####
+    // #  #
+    //  ####
+    0x20, 0x54, 0x54, 0x7C, 0x54,
+
+    /* @720 '\x92' (5 pixels wide) */
+    //   ###
+    //  # #
+    // #  #
+    // #####
+    // #  #
+    // #  #
+    // #  ##
+    0x7C, 0x0A, 0x09, 0x7F, 0x49,
+
+    /* @725 '\x93' (5 pixels wide) */
+    //  ###
+    // #   #
+    //
+    //  ###
+    // #   #
+    // #   #
+    //  ###
+    0x32, 0x49, 0x49, 0x49, 0x32,
+
+    /* @730 '\x94' (5 pixels wide) */
+    //
+    // #   #
+    //  ###
+    // #   #
+    // #   #
+    // #   #
+    //  ###
+    0x3A, 0x44, 0x44, 0x44, 0x3A,
+
+    /* @735 '\x95' (5 pixels wide) */
+    //
+    // ##
+    //
+    //  ###
+    // #   #
+    // #   #
+    //  ###
+    0x32, 0x4A, 0x48, 0x48, 0x30,
+
+    /* @740 '\x96' (5 pixels wide) */
+    //  ###
+    // #   #
+    //
+    // #   #
+    // #   #
+    // #  ##
+    //  ## #
+    0x3A, 0x41, 0x41, 0x21, 0x7A,
+
+    /* @745 '\x97' (5 pixels wide) */
+    //
+    // ##
+    //
+    // #   #
+    // #   #
+    // #  ##
+    //  ## #
+    0x3A, 0x42, 0x40, 0x20, 0x78,
+
+    /* @750 '\x98' (5 pixels wide) */
+    //  #  #
+    //
+    //  #  #
+    //  #  #
+    //  #  #
+    //   ###
+    //     #
+    0x00, 0x1D, 0x20, 0x20, 0x7D,
+
+    /* @755 '\x99' (5 pixels wide) */
+    // #   #
+    //  ###
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    //  ###
+    0x3D, 0x42, 0x42, 0x42, 0x3D,
+
+    /* @760 '\x9A' (5 pixels wide) */
+    // #   #
+    //
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    //  ###
+    0x3D, 0x40, 0x40, 0x40, 0x3D,
+
+    /* @765 '\x9B' (5 pixels wide) */
+    //   #
+    //   #
+    // #####
+    // # #
+    // # #
+    // #####
+    //   #
+    0x3C, 0x24, 0x7F, 0x24, 0x24,
+
+    /* @770 '\x9C' (5 pixels wide) */
+    //   ##
+    //  # ##
+    //  #  #
+    // ###
+    //  #
+    //  #  #
+    // #####
+    0x48, 0x7E, 0x49, 0x43, 0x66,
+
+    /* @775 '\x9D' (5 pixels wide) */
+    // ## ##
+    // ## ##
+    //  ###
+    // #####
+    //   #
+    // #####
+    //   #
+    0x2B, 0x2F, 0x7C, 0x2F, 0x2B,
+
+    /* @780 '\x9E' (5 pixels wide) */
+    // ###
+    // #  #
+    // #  #
+    // ###
+    // #  #
+    // # ###
+    // #  #
+    0x7F, 0x09, 0x29, 0x76, 0x20,
+
+    /* @785 '\x9F' (5 pixels wide) */
+    //    ##
+    //   # #
+    //   #
+    //  ###
+    //   #
+    //   #
+    // # #
+    0x40, 0x08, 0x7E, 0x09, 0x03,
+
+    /* @790 '\xA0' (5 pixels wide) */
+    //    ##
+    //
+    //  ##
+    //    #
+    //  ###
+    // #  #
+    //  ####
+    0x20, 0x54, 0x54, 0x79, 0x41,
+
+    /* @795 '\xA1' (5 pixels wide) */
+    //    ##
+    //
+    //   ##
+    //    #
+    //    #
+    //    #
+    //   ###
+    0x00, 0x00, 0x44, 0x7D, 0x41,
+
+    /* @800 '\xA2' (5 pixels wide) */
+    //
+    //    ##
+    //
+    //  ###
+    // #   #
+    // #   #
+    //  ###
+    0x30, 0x48, 0x48, 0x4A, 0x32,
+
+    /* @805 '\xA3' (5 pixels wide) */
+    //
+    //    ##
+    //
+    // #   #
+    // #   #
+    // #  ##
+    //  ## #
+    0x38, 0x40, 0x40, 0x22, 0x7A,
+
+    /* @810 '\xA4' (5 pixels wide) */
+    //
+    //  ####
+    //
+    //  ###
+    //  #  #
+    //  #  #
+    //  #  #
+    0x00, 0x7A, 0x0A, 0x0A, 0x72,
+
+    /* @815 '\xA5' (5 pixels wide) */
+    // #####
+    //
+    // ##  #
+    // ### #
+    // # ###
+    // #  ##
+    // #   #
+    0x7D, 0x0D, 0x19, 0x31, 0x7D,
+
+    /* @820 '\xA6' (5 pixels wide) */
+    //  ###
+    // #  #
+    // #  #
+    //  ####
+    //
+    // #####
+    //
+    0x26, 0x29, 0x29, 0x2F, 0x28,
+
+    /* @825 '\xA7' (5 pixels wide) */
+    //  ###
+    // #   #
+    // #   #
+    //  ###
+    //
+    // #####
+    //
+    0x26, 0x29, 0x29, 0x29, 0x26,
+
+    /* @830 '\xA8' (5 pixels wide) */
+    //   #
+    //
+    //   #
+    //  ##
+    // #
+    // #   #
+    //  ###
+    0x30, 0x48, 0x4D, 0x40, 0x20,
+
+    /* @835 '\xA9' (5 pixels wide) */
+    //
+    //
+    //
+    // #####
+    // #
+    // #
+    //
+    0x38, 0x08, 0x08, 0x08, 0x08,
+
+    /* @840 '\xAA' (5 pixels wide) */
+    //
+    //
+    //
+    // #####
+    //     #
+    //     #
+    //
+    0x08, 0x08, 0x08, 0x08, 0x38,
+
+    /* @845 '\xAB' (5 pixels wide) */
+    // #
+    // #   #
+    // #  #
+    // # ###
+    //  #  #
+    // #  ##
+    //   #
+    0x2F, 0x10, 0x48, 0x2C, 0x3A,
+
+    /* @850 '\xAC' (5 pixels wide) */
+    // #
+    // #   #
+    // #  #
+    // # # #
+    //  # ##
+    // # ###
+    //     #
+    0x2F, 0x10, 0x28, 0x34, 0x7A,
+
+    /* @855 '\xAD' (5 pixels wide) */
+    //   #
+    //   #
+    //
+    //   #
+    //   #
+    //   #
+    //   #
+    0x00, 0x00, 0x7B, 0x00, 0x00,
+
+    /* @860 '\xAE' (5 pixels wide) */
+    //
+    //   # #
+    //  # #
+    // # #
+    //  # #
+    //   # #
+    //
+    0x08, 0x14, 0x2A, 0x14, 0x22,
+
+    /* @865 '\xAF' (5 pixels wide) */
+    //
+    // # #
+    //  # #
+    //   # #
+    //  # #
+    // # #
+    //
+    0x22, 0x14, 0x2A, 0x14, 0x08,
+
+    /* @870 '\xB0' (5 pixels wide) */
+    //   #
+    // #   #
+    //   #
+    // #   #
+    //   #
+    // #   #
+    //   #
+    0x2A, 0x00, 0x55, 0x00, 0x2A,
+
+    /* @875 '\xB1' (5 pixels wide) */
+    //  # #
+    // # # #
+    //  # #
+    // # # #
+    //  # #
+    // # # #
+    //  # #
+    0x2A, 0x55, 0x2A, 0x55, 0x2A,
+
+    /* @880 '\xB2' (5 pixels wide) */
+    //    #
+    //    #
+    //    #
+    //    #
+    //    #
+    //    #
+    //    #
+    0x00, 0x00, 0x00, 0x7F, 0x00,
+
+    /* @885 '\xB3' (5 pixels wide) */
+    //    #
+    //    #
+    //    #
+    //    #
+    // ####
+    //    #
+    //    #
+    0x10, 0x10, 0x10, 0x7F, 0x00,
+
+    /* @890 '\xB4' (5 pixels wide) */
+    //    #
+    //    #
+    // ####
+    //    #
+    // ####
+    //    #
+    //    #
+    0x14, 0x14, 0x14, 0x7F, 0x00,
+
+    /* @895 '\xB5' (5 pixels wide) */
+    //   # #
+    //   # #
+    //   # #
+    //   # #
+    // ### #
+    //   # #
+    //   # #
+    0x10, 0x10, 0x7F, 0x00, 0x7F,
+
+    /* @900 '\xB6' (5 pixels wide) */
+    //
+    //
+    //
+    //
+    // #####
+    //   # #
+    //   # #
+    0x10, 0x10, 0x70, 0x10, 0x70,
+
+    /* @905 '\xB7' (5 pixels wide) */
+    //
+    //
+    // ####
+    //    #
+    // ####
+    //    #
+    //    #
+    0x14, 0x14, 0x14, 0x7C, 0x00,
+
+    /* @910 '\xB8' (5 pixels wide) */
+    //   # #
+    //   # #
+    // ### #
+    //     #
+    // ### #
+    //   # #
+    //   # #
+    0x14, 0x14, 0x77, 0x00, 0x7F,
+
+    /* @915 '\xB9' (5 pixels wide) */
+    //   # #
+    //   # #
+    //   # #
+    //   # #
+    //   # #
+    //   # #
+    //   # #
+    0x00, 0x00, 0x7F, 0x00, 0x7F,
+
+    /* @920 '\xBA' (5 pixels wide) */
+    //
+    //
+    // #####
+    //     #
+    // ### #
+    //   # #
+    //   # #
+    0x14, 0x14, 0x74, 0x04, 0x7C,
+
+    /* @925 '\xBB' (5 pixels wide) */
+    //   # #
+    //   # #
+    // ### #
+    //     #
+    // #####
+    //
+    //
+    0x14, 0x14, 0x17, 0x10, 0x1F,
+
+    /* @930 '\xBC' (5 pixels wide) */
+    //   # #
+    //   # #
+    //   # #
+    //   # #
+    // #####
+    //
+    //
+    0x10, 0x10, 0x1F, 0x10, 0x1F,
+
+    /* @935 '\xBD' (5 pixels wide) */
+    //    #
+    //    #
+    // ####
+    //    #
+    // ####
+    //
+    //
+    0x14, 0x14, 0x14, 0x1F, 0x00,
+
+    /* @940 '\xBE' (5 pixels wide) */
+    //
+    //
+    //
+    //
+    // ####
+    //    #
+    //    #
+    0x10, 0x10, 0x10, 0x70, 0x00,
+
+    /* @945 '\xBF' (5 pixels wide) */
+    //    #
+    //    #
+    //    #
+    //    #
+    //    ##
+    //
+    //
+    0x00, 0x00, 0x00, 0x1F, 0x10,
+
+    /* @950 '\xC0' (5 pixels wide) */
+    //    #
+    //    #
+    //    #
+    //    #
+    // #####
+    //
+    //
+    0x10, 0x10, 0x10, 0x1F, 0x10,
+
+    /* @955 '\xC1' (5 pixels wide) */
+    //
+    //
+    //
+    //
+    // #####
+    //    #
+    //    #
+    0x10, 0x10, 0x10, 0x70, 0x10,
+
+    /* @960 '\xC2' (5 pixels wide) */
+    //    #
+    //    #
+    //    #
+    //    #
+    //    ##
+    //    #
+    //    #
+    0x00, 0x00, 0x00, 0x7F, 0x10,
+
+    /* @965 '\xC3' (5 pixels wide) */
+    //
+    //
+    //
+    //
+    // #####
+    //
+    //
+    0x10, 0x10, 0x10, 0x10, 0x10,
+
+    /* @970 '\xC4' (5 pixels wide) */
+    //    #
+    //    #
+    //    #
+    //    #
+    // #####
+    //    #
+    //    #
+    0x10, 0x10, 0x10, 0x7F, 0x10,
+
+    /* @975 '\xC5' (5 pixels wide) */
+    //    #
+    //    #
+    //    ##
+    //    #
+    //    ##
+    //    #
+    //    #
+    0x00, 0x00, 0x00, 0x7F, 0x14,
+
+    /* @980 '\xC7' (5 pixels wide) */
+    //   # #
+    //   # #
+    //   # #
+    //   #
+    //   ###
+    //
+    //
+    0x00, 0x00, 0x1F, 0x10, 0x17,
+
+    /* @985 '\xC8' (5 pixels wide) */
+    //
+    //
+    //   ###
+    //   #
+    //   # #
+    //   # #
+    //   # #
+    0x00, 0x00, 0x7C, 0x04, 0x74,
+
+    /* @990 '\xC9' (5 pixels wide) */
+    //   # #
+    //   # #
+    // ### #
+    //
+    // #####
+    //
+    //
+    0x14, 0x14, 0x17, 0x10, 0x17,
+
+    /* @995 '\xCA' (5 pixels wide) */
+    //
+    //
+    // #####
+    //
+    // ### #
+    //   # #
+    //   # #
+    0x14, 0x14, 0x74, 0x04, 0x74,
+
+    /* @1000 '\xCB' (5 pixels wide) */
+    //   # #
+    //   # #
+    //   # #
+    //   #
+    //   # #
+    //   # #
+    //   # #
+    0x00, 0x00, 0x7F, 0x00, 0x77,
+
+    /* @1005 '\xCD' (5 pixels wide) */
+    //   # #
+    //   # #
+    // ### #
+    //
+    // ### #
+    //   # #
+    //   # #
+    0x14, 0x14, 0x77, 0x00, 0x77,
+
+    /* @1010 '\xCE' (5 pixels wide) */
+    //    #
+    //    #
+    // #####
+    //
+    // #####
+    //
+    //
+    0x14, 0x14, 0x14, 0x17, 0x14,
+
+    /* @1015 '\xD0' (5 pixels wide) */
+    //
+    //
+    // #####
+    //
+    // #####
+    //    #
+    //    #
+    0x14, 0x14, 0x14, 0x74, 0x14,
+
+    /* @1020 '\xD2' (5 pixels wide) */
+    //   # #
+    //   # #
+    //   # #
+    //   # #
+    //   ###
+    //
+    //
+    0x00, 0x00, 0x1F, 0x10, 0x1F,
+
+    /* @1025 '\xD3' (5 pixels wide) */
+    //    #
+    //    #
+    //    ##
+    //    #
+    //    ##
+    //
+    //
+    0x00, 0x00, 0x00, 0x1F, 0x14,
+
+    /* @1030 '\xD4' (5 pixels wide) */
+    //
+    //
+    //    ##
+    //    #
+    //    ##
+    //    #
+    //    #
+    0x00, 0x00, 0x00, 0x7C, 0x14,
+
+    /* @1035 '\xD5' (5 pixels wide) */
+    //
+    //
+    //
+    //
+    //   ###
+    //   # #
+    //   # #
+    0x00, 0x00, 0x70, 0x10, 0x70,
+
+    /* @1040 '\xD6' (5 pixels wide) */
+    //   # #
+    //   # #
+    //   # #
+    //   # #
+    // #####
+    //   # #
+    //   # #
+    0x10, 0x10, 0x7F, 0x10, 0x7F,
+
+    /* @1045 '\xD7' (5 pixels wide) */
+    //    #
+    //    #
+    // #####
+    //    #
+    // #####
+    //    #
+    //    #
+    0x14, 0x14, 0x14, 0x7F, 0x14,
+
+    /* @1050 '\xD8' (5 pixels wide) */
+    //    #
+    //    #
+    //    #
+    //    #
+    // ####
+    //
+    //
+    0x10, 0x10, 0x10, 0x1F, 0x00,
+
+    /* @1055 '\xD9' (5 pixels wide) */
+    //
+    //
+    //
+    //
+    //    ##
+    //    #
+    //    #
+    0x00, 0x00, 0x00, 0x70, 0x10,
+
+    /* @1060 '\xDA' (5 pixels wide) */
+    // #####
+    // #####
+    // #####
+    // #####
+    // #####
+    // #####
+    // #####
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+
+    /* @1065 '\xDB' (5 pixels wide) */
+    //
+    //
+    //
+    //
+    // #####
+    // #####
+    // #####
+    0x70, 0x70, 0x70, 0x70, 0x70,
+
+    /* @1070 '\xDC' (5 pixels wide) */
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    0x7F, 0x7F, 0x7F, 0x00, 0x00,
+
+    /* @1075 '\xDD' (5 pixels wide) */
+    //    ##
+    //    ##
+    //    ##
+    //    ##
+    //    ##
+    //    ##
+    //    ##
+    0x00, 0x00, 0x00, 0x7F, 0x7F,
+
+    /* @1080 '\xDE' (5 pixels wide) */
+    // #####
+    // #####
+    // #####
+    // #####
+    //
+    //
+    //
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+
+    /* @1085 '\xDF' (5 pixels wide) */
+    //
+    //
+    //  ## #
+    // #  #
+    // #  #
+    // #  #
+    //  ## #
+    0x38, 0x44, 0x44, 0x38, 0x44,
+
+    /* @1090 '\xE0' (5 pixels wide) */
+    //
+    //  ###
+    // #   #
+    // ####
+    // #   #
+    // #   #
+    // ####
+    0x7C, 0x4A, 0x4A, 0x4A, 0x34,
+
+    /* @1095 '\xE1' (5 pixels wide) */
+    //
+    // #####
+    // #  ##
+    // #
+    // #
+    // #
+    // #
+    0x7E, 0x02, 0x02, 0x06, 0x06,
+
+    /* @1100 '\xE2' (5 pixels wide) */
+    //
+    // #####
+    //  # #
+    //  # #
+    //  # #
+    //  # #
+    //  # #
+    0x02, 0x7E, 0x02, 0x7E, 0x02,
+
+    /* @1105 '\xE3' (5 pixels wide) */
+    // #####
+    // #   #
+    //  #
+    //   #
+    //  #
+    // #   #
+    // #####
+    0x63, 0x55, 0x49, 0x41, 0x63,
+
+    /* @1110 '\xE4' (5 pixels wide) */
+    //
+    //
+    //  ####
+    // #  #
+    // #  #
+    // #  #
+    //  ##
+    0x38, 0x44, 0x44, 0x3C, 0x04,
+
+    /* @1115 '\xE5' (5 pixels wide) */
+    //
+    //  # #
+    //  # #
+    //  # #
+    //  # #
+    //  ## #
+    // ##
+    0x40, 0x7E, 0x20, 0x1E, 0x20,
+
+    /* @1120 '\xE6' (5 pixels wide) */
+    //
+    // #####
+    // # #
+    //   #
+    //   #
+    //   #
+    //   #
+    0x06, 0x02, 0x7E, 0x02, 0x02,
+
+    /* @1125 '\xE7' (5 pixels wide) */
+    // #####
+    //   #
+    //  ###
+    // #   #
+    // #   #
+    //  ###
+    //   #
+    0x19, 0x25, 0x67, 0x25, 0x19,
+
+    /* @1130 '\xE8' (5 pixels wide) */
+    //   #
+    //  # #
+    // #   #
+    // #####
+    // #   #
+    //  # #
+    //   #
+    0x1C, 0x2A, 0x49, 0x2A, 0x1C,
+
+    /* @1135 '\xE9' (5 pixels wide) */
+    //   #
+    //  # #
+    // #   #
+    // #   #
+    //  # #
+    //  # #
+    // ## ##
+    0x4C, 0x72, 0x01, 0x72, 0x4C,
+
+    /* @1140 '\xEA' (5 pixels wide) */
+    //   ##
+    //  #
+    //   ##
+    //  ###
+    // #   #
+    // #   #
+    //  ###
+    0x30, 0x4A, 0x4D, 0x4D, 0x30,
+
+    /* @1145 '\xEB' (5 pixels wide) */
+    //
+    //
+    //
+    //  ###
+    // # # #
+    // # # #
+    //  ###
+    0x30, 0x48, 0x78, 0x48, 0x30,
+
+    /* @1150 '\xEC' (5 pixels wide) */
+    //     #
+    //  ###
+    // #  ##
+    // # # #
+    // # # #
+    // ##  #
+    //  ###
+    0x3C, 0x62, 0x5A, 0x46, 0x3D,
+
+    /* @1155 '\xED' (5 pixels wide) */
+    //  ###
+    // #
+    // #
+    // ####
+    // #
+    // #
+    //  ###
+    0x3E, 0x49, 0x49, 0x49, 0x00,
+
+    /* @1160 '\xEE' (5 pixels wide) */
+    //  ###
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    // #   #
+    0x7E, 0x01, 0x01, 0x01, 0x7E,
+
+    /* @1165 '\xEF' (5 pixels wide) */
+    //
+    // #####
+    //
+    // #####
+    //
+    // #####
+    //
+    0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+
+    /* @1170 '\xF0' (5 pixels wide) */
+    //   #
+    //   #
+    // #####
+    //   #
+    //   #
+    //
+    // #####
+    0x44, 0x44, 0x5F, 0x44, 0x44,
+
+    /* @1175 '\xF1' (5 pixels wide) */
+    //  #
+    //   #
+    //    #
+    //   #
+    //  #
+    //
+    // #####
+    0x40, 0x51, 0x4A, 0x44, 0x40,
+
+    /* @1180 '\xF2' (5 pixels wide) */
+    //    #
+    //   #
+    //  #
+    //   #
+    //    #
+    //
+    // #####
+    0x40, 0x44, 0x4A, 0x51, 0x40,
+
+    /* @1185 '\xF3' (5 pixels wide) */
+    //   ###
+    //   # #
+    //   #
+    //   #
+    //   #
+    //   #
+    //   #
+    0x00, 0x00, 0x7F, 0x01, 0x03,
+
+    /* @1190 '\xF4' (5 pixels wide) */
+    //   #
+    //   #
+    //   #
+    //   #
+    //   #
+    // # #
+    // # #
+    0x60, 0x00, 0x7F, 0x00, 0x00,
+
+    /* @1195 '\xF5' (5 pixels wide) */
+    //   ##
+    //   ##
+    //
+    // #####
+    //
+    //   ##
+    //   ##
+    0x08, 0x08, 0x6B, 0x6B, 0x08,
+
+    /* @1200 '\xF6' (5 pixels wide) */
+    //
+    // ### #
+    // # ###
+    //
+    // ### #
+    // # ###
+    //
+    0x36, 0x12, 0x36, 0x24, 0x36,
+
+    /* @1205 '\xF7' (5 pixels wide) */
+    //  ###
+    // ## ##
+    // ## ##
+    //  ###
+    //
+    //
+    //
+    0x06, 0x0F, 0x09, 0x0F, 0x06,
+
+    /* @1210 '\xF8' (5 pixels wide) */
+    //
+    //
+    //
+    //   ##
+    //   ##
+    //
+    //
+    0x00, 0x00, 0x18, 0x18, 0x00,
+
+    /* @1215 '\xF9' (5 pixels wide) */
+    //
+    //
+    //
+    //
+    //   ##
+    //
+    //
+    0x00, 0x00, 0x10, 0x10, 0x00,
+
+    /* @1220 '\xFA' (5 pixels wide) */
+    //   ###
+    //   #
+    //   #
+    //   #
+    // # #
+    // # #
+    //  ##
+    0x30, 0x40, 0x7F, 0x01, 0x01,
+
+    /* @1225 '\xFB' (5 pixels wide) */
+    //  ###
+    //  #  #
+    //  #  #
+    //  #  #
+    //  #  #
+    //
+    //
+    0x00, 0x1F, 0x01, 0x01, 0x1E,
+
+    /* @1230 '\xFC' (5 pixels wide) */
+    //  ###
+    //    ##
+    //   ##
+    //  ##
+    //  ####
+    //
+    //
+    0x00, 0x19, 0x1D, 0x17, 0x12,
+
+    /* @1235 '\xFD' (5 pixels wide) */
+    //
+    //
+    //  ####
+    //  ####
+    //  ####
+    //  ####
+    //
+    0x00, 0x3C, 0x3C, 0x3C, 0x3C,
+
+    /* @1240 '\xFF' (5 pixels wide) */
+    //     #
+    //   # #
+    //     #
+    //   # #
+    //
+    //  ####
+    //     #
+    0x00, 0x20, 0x2A, 0x20, 0x6F,
 };
 
 /* Character descriptors for glcd 5x7 */
 /* { [Char width in bits], [Offset into glcd_5x7_bitmaps in bytes] } */
-const font_char_desc_t glcd_5x7_descriptors[] = 
+const font_char_desc_t glcd_5x7_descriptors[] =
 {
-    {5, 0},     /* \x00 */
-    {5, 7},     /* \x01 */
-    {5, 14},    /* \x02 */
-    {5, 21},    /* \x03 */
-    {5, 28},    /* \x04 */
-    {5, 35},    /* \x05 */
-    {5, 42},    /* \x06 */
-    {5, 49},    /* \x07 */
-    {5, 56},    /* \x08 */
-    {5, 63},    /* \x09 */
-    {5, 70},    /* \x0A */
-    {5, 77},    /* \x0B */
-    {5, 84},    /* \x0C */
-    {5, 91},    /* \x0D */
-    {5, 98},    /* \x0E */
-    {5, 105},   /* \x0F */
-    {5, 112},   /* \x10 */
-    {5, 119},   /* \x11 */
-    {5, 126},   /* \x12 */
-    {5, 133},   /* \x13 */
-    {5, 140},   /* \x14 */
-    {5, 147},   /* \x15 */
-    {5, 154},   /* \x16 */
-    {5, 161},   /* \x17 */
-    {5, 168},   /* \x18 */
-    {5, 175},   /* \x19 */
-    {5, 182},   /* \x1A */
-    {5, 189},   /* \x1B */
-    {5, 196},   /* \x1C */
-    {5, 203},   /* \x1D */
-    {5, 210},   /* \x1E */
-    {5, 217},   /* \x1F */
-    {5, 224},   /*      */
-    {5, 231},   /*   !  */
-    {5, 238},   /*   "  */
-    {5, 245},   /*   #  */
-    {5, 252},   /*   $  */
-    {5, 259},   /*   %  */
-    {5, 266},   /*   &  */
-    {5, 273},   /*   '  */
-    {5, 280},   /*   (  */
-    {5, 287},   /*   )  */
-    {5, 294},   /*   *  */
-    {5, 301},   /*   +  */
-    {5, 308},   /*   ,  */
-    {5, 315},   /*   -  */
-    {5, 322},   /*   .  */
-    {5, 329},   /*   /  */
-    {5, 336},   /*   0  */
-    {5, 343},   /*   1  */
-    {5, 350},   /*   2  */
-    {5, 357},   /*   3  */
-    {5, 364},   /*   4  */
-    {5, 371},   /*   5  */
-    {5, 378},   /*   6  */
-    {5, 385},   /*   7  */
-    {5, 392},   /*   8  */
-    {5, 399},   /*   9  */
-    {5, 406},   /*   :  */
-    {5, 413},   /*   ;  */
-    {5, 420},   /*   <  */
-    {5, 427},   /*   =  */
-    {5, 434},   /*   >  */
-    {5, 441},   /*   ?  */
-    {5, 448},   /*   @  */
-    {5, 455},   /*   A  */
-    {5, 462},   /*   B  */
-    {5, 469},   /*   C  */
-    {5, 476},   /*   D  */
-    {5, 483},   /*   E  */
-    {5, 490},   /*   F  */
-    {5, 497},   /*   G  */
-    {5, 504},   /*   H  */
-    {5, 511},   /*   I  */
-    {5, 518},   /*   J  */
-    {5, 525},   /*   K  */
-    {5, 532},   /*   L  */
-    {5, 539},   /*   M  */
-    {5, 546},   /*   N  */
-    {5, 553},   /*   O  */
-    {5, 560},   /*   P  */
-    {5, 567},   /*   Q  */
-    {5, 574},   /*   R  */
-    {5, 581},   /*   S  */
-    {5, 588},   /*   T  */
-    {5, 595},   /*   U  */
-    {5, 602},   /*   V  */
-    {5, 609},   /*   W  */
-    {5, 616},   /*   X  */
-    {5, 623},   /*   Y  */
-    {5, 630},   /*   Z  */
-    {5, 637},   /*   [  */
-    {5, 644},   /*   \  */
-    {5, 651},   /*   ]  */
-    {5, 658},   /*   ^  */
-    {5, 665},   /*   _  */
-    {5, 672},   /*   `  */
-    {5, 679},   /*   a  */
-    {5, 686},   /*   b  */
-    {5, 693},   /*   c  */
-    {5, 700},   /*   d  */
-    {5, 707},   /*   e  */
-    {5, 714},   /*   f  */
-    {5, 721},   /*   g  */
-    {5, 728},   /*   h  */
-    {5, 735},   /*   i  */
-    {5, 742},   /*   j  */
-    {5, 749},   /*   k  */
-    {5, 756},   /*   l  */
-    {5, 763},   /*   m  */
-    {5, 770},   /*   n  */
-    {5, 777},   /*   o  */
-    {5, 784},   /*   p  */
-    {5, 791},   /*   q  */
-    {5, 798},   /*   r  */
-    {5, 805},   /*   s  */
-    {5, 812},   /*   t  */
-    {5, 819},   /*   u  */
-    {5, 826},   /*   v  */
-    {5, 833},   /*   w  */
-    {5, 840},   /*   x  */
-    {5, 847},   /*   y  */
-    {5, 854},   /*   z  */
-    {5, 861},   /*   {  */
-    {5, 868},   /*   |  */
-    {5, 875},   /*   }  */
-    {5, 882},   /*   ~  */
-    {5, 889},   /* \x7F */
-    {5, 896},   /* \x80 */
-    {5, 903},   /* \x81 */
-    {5, 910},   /* \x82 */
-    {5, 917},   /* \x83 */
-    {5, 924},   /* \x84 */
-    {5, 931},   /* \x85 */
-    {5, 938},   /* \x86 */
-    {5, 945},   /* \x87 */
-    {5, 952},   /* \x88 */
-    {5, 959},   /* \x89 */
-    {5, 966},   /* \x8A */
-    {5, 973},   /* \x8B */
-    {5, 980},   /* \x8C */
-    {5, 987},   /* \x8D */
-    {5, 994},   /* \x8E */
-    {5, 1001},  /* \x8F */
-    {5, 1008},  /* \x90 */
-    {5, 1015},  /* \x91 */
-    {5, 1022},  /* \x92 */
-    {5, 1029},  /* \x93 */
-    {5, 1036},  /* \x94 */
-    {5, 1043},  /* \x95 */
-    {5, 1050},  /* \x96 */
-    {5, 1057},  /* \x97 */
-    {5, 1064},  /* \x98 */
-    {5, 1071},  /* \x99 */
-    {5, 1078},  /* \x9A */
-    {5, 1085},  /* \x9B */
-    {5, 1092},  /* \x9C */
-    {5, 1099},  /* \x9D */
-    {5, 1106},  /* \x9E */
-    {5, 1113},  /* \x9F */
-    {5, 1120},  /* \xA0 */
-    {5, 1127},  /* \xA1 */
-    {5, 1134},  /* \xA2 */
-    {5, 1141},  /* \xA3 */
-    {5, 1148},  /* \xA4 */
-    {5, 1155},  /* \xA5 */
-    {5, 1162},  /* \xA6 */
-    {5, 1169},  /* \xA7 */
-    {5, 1176},  /* \xA8 */
-    {5, 1183},  /* \xA9 */
-    {5, 1190},  /* \xAA */
-    {5, 1197},  /* \xAB */
-    {5, 1204},  /* \xAC */
-    {5, 1211},  /* \xAD */
-    {5, 1218},  /* \xAE */
-    {5, 1225},  /* \xAF */
-    {5, 1232},  /* \xB0 */
-    {5, 1239},  /* \xB1 */
-    {5, 1246},  /* \xB2 */
-    {5, 1253},  /* \xB3 */
-    {5, 1260},  /* \xB4 */
-    {5, 1267},  /* \xB5 */
-    {5, 1274},  /* \xB6 */
-    {5, 1281},  /* \xB7 */
-    {5, 1288},  /* \xB8 */
-    {5, 1295},  /* \xB9 */
-    {5, 1302},  /* \xBA */
-    {5, 1309},  /* \xBB */
-    {5, 1316},  /* \xBC */
-    {5, 1323},  /* \xBD */
-    {5, 1330},  /* \xBE */
-    {5, 1337},  /* \xBF */
-    {5, 1344},  /* \xC0 */
-    {5, 1351},  /* \xC1 */
-    {5, 1358},  /* \xC2 */
-    {5, 1365},  /* \xC3 */
-    {5, 1372},  /* \xC4 */
-    {5, 1379},  /* \xC5 */
-    {5, 1386},  /* \xC6 */
-    {5, 1393},  /* \xC7 */
-    {5, 1400},  /* \xC8 */
-    {5, 1407},  /* \xC9 */
-    {5, 1414},  /* \xCA */
-    {5, 1421},  /* \xCB */
-    {5, 1428},  /* \xCC */
-    {5, 1435},  /* \xCD */
-    {5, 1442},  /* \xCE */
-    {5, 1449},  /* \xCF */
-    {5, 1456},  /* \xD0 */
-    {5, 1463},  /* \xD1 */
-    {5, 1470},  /* \xD2 */
-    {5, 1477},  /* \xD3 */
-    {5, 1484},  /* \xD4 */
-    {5, 1491},  /* \xD5 */
-    {5, 1498},  /* \xD6 */
-    {5, 1505},  /* \xD7 */
-    {5, 1512},  /* \xD8 */
-    {5, 1519},  /* \xD9 */
-    {5, 1526},  /* \xDA */
-    {5, 1533},  /* \xDB */
-    {5, 1540},  /* \xDC */
-    {5, 1547},  /* \xDD */
-    {5, 1554},  /* \xDE */
-    {5, 1561},  /* \xDF */
-    {5, 1568},  /* \xE0 */
-    {5, 1575},  /* \xE1 */
-    {5, 1582},  /* \xE2 */
-    {5, 1589},  /* \xE3 */
-    {5, 1596},  /* \xE4 */
-    {5, 1603},  /* \xE5 */
-    {5, 1610},  /* \xE6 */
-    {5, 1617},  /* \xE7 */
-    {5, 1624},  /* \xE8 */
-    {5, 1631},  /* \xE9 */
-    {5, 1638},  /* \xEA */
-    {5, 1645},  /* \xEB */
-    {5, 1652},  /* \xEC */
-    {5, 1659},  /* \xED */
-    {5, 1666},  /* \xEE */
-    {5, 1673},  /* \xEF */
-    {5, 1680},  /* \xF0 */
-    {5, 1687},  /* \xF1 */
-    {5, 1694},  /* \xF2 */
-    {5, 1701},  /* \xF3 */
-    {5, 1708},  /* \xF4 */
-    {5, 1715},  /* \xF5 */
-    {5, 1722},  /* \xF6 */
-    {5, 1729},  /* \xF7 */
-    {5, 1736},  /* \xF8 */
-    {5, 1743},  /* \xF9 */
-    {5, 1750},  /* \xFA */
-    {5, 1757},  /* \xFB */
-    {5, 1764},  /* \xFC */
-    {5, 1771},  /* \xFD */
-    {5, 1778},  /* \xFE */
-    {5, 1785},  /* \xFF */
+    {5, 0},       /* '\x0' */
+    {5, 5},       /* '\x1' */
+    {5, 10},      /* '\x2' */
+    {5, 15},      /* '\x3' */
+    {5, 20},      /* '\x4' */
+    {5, 25},      /* '\x5' */
+    {5, 30},      /* '\x6' */
+    {5, 35},      /* '\x7' */
+    {5, 40},      /* '\x8' */
+    {5, 45},      /* '\x9' */
+    {5, 50},      /* '\xA' */
+    {5, 55},      /* '\xB' */
+    {5, 60},      /* '\xC' */
+    {5, 65},      /* '\xD' */
+    {5, 70},      /* '\xE' */
+    {5, 75},      /* '\xF' */
+    {5, 80},      /* '\x10' */
+    {5, 85},      /* '\x11' */
+    {5, 90},      /* '\x12' */
+    {5, 95},      /* '\x13' */
+    {5, 100},     /* '\x14' */
+    {5, 105},     /* '\x15' */
+    {5, 110},     /* '\x16' */
+    {5, 90},      /* '\x17' */
+    {5, 115},     /* '\x18' */
+    {5, 120},     /* '\x19' */
+    {5, 125},     /* '\x1A' */
+    {5, 130},     /* '\x1B' */
+    {5, 135},     /* '\x1C' */
+    {5, 140},     /* '\x1D' */
+    {5, 145},     /* '\x1E' */
+    {5, 150},     /* '\x1F' */
+    {5, 0},       /* ' ' */
+    {5, 155},     /* '!' */
+    {5, 160},     /* '"' */
+    {5, 165},     /* '#' */
+    {5, 170},     /* '$' */
+    {5, 175},     /* '%' */
+    {5, 180},     /* '&' */
+    {5, 185},     /* '\x27' */
+    {5, 190},     /* '(' */
+    {5, 195},     /* ')' */
+    {5, 200},     /* '*' */
+    {5, 205},     /* '+' */
+    {5, 210},     /* ',' */
+    {5, 215},     /* '-' */
+    {5, 220},     /* '.' */
+    {5, 225},     /* '/' */
+    {5, 230},     /* '0' */
+    {5, 235},     /* '1' */
+    {5, 240},     /* '2' */
+    {5, 245},     /* '3' */
+    {5, 250},     /* '4' */
+    {5, 255},     /* '5' */
+    {5, 260},     /* '6' */
+    {5, 265},     /* '7' */
+    {5, 270},     /* '8' */
+    {5, 275},     /* '9' */
+    {5, 280},     /* ':' */
+    {5, 285},     /* ';' */
+    {5, 290},     /* '<' */
+    {5, 295},     /* '=' */
+    {5, 300},     /* '>' */
+    {5, 305},     /* '?' */
+    {5, 310},     /* '@' */
+    {5, 315},     /* 'A' */
+    {5, 320},     /* 'B' */
+    {5, 325},     /* 'C' */
+    {5, 330},     /* 'D' */
+    {5, 335},     /* 'E' */
+    {5, 340},     /* 'F' */
+    {5, 345},     /* 'G' */
+    {5, 350},     /* 'H' */
+    {5, 355},     /* 'I' */
+    {5, 360},     /* 'J' */
+    {5, 365},     /* 'K' */
+    {5, 370},     /* 'L' */
+    {5, 375},     /* 'M' */
+    {5, 380},     /* 'N' */
+    {5, 385},     /* 'O' */
+    {5, 390},     /* 'P' */
+    {5, 395},     /* 'Q' */
+    {5, 400},     /* 'R' */
+    {5, 405},     /* 'S' */
+    {5, 410},     /* 'T' */
+    {5, 415},     /* 'U' */
+    {5, 420},     /* 'V' */
+    {5, 425},     /* 'W' */
+    {5, 430},     /* 'X' */
+    {5, 435},     /* 'Y' */
+    {5, 440},     /* 'Z' */
+    {5, 445},     /* '[' */
+    {5, 450},     /* '\x5C' */
+    {5, 455},     /* ']' */
+    {5, 460},     /* '^' */
+    {5, 465},     /* '_' */
+    {5, 470},     /* '`' */
+    {5, 475},     /* 'a' */
+    {5, 480},     /* 'b' */
+    {5, 485},     /* 'c' */
+    {5, 490},     /* 'd' */
+    {5, 495},     /* 'e' */
+    {5, 500},     /* 'f' */
+    {5, 505},     /* 'g' */
+    {5, 510},     /* 'h' */
+    {5, 515},     /* 'i' */
+    {5, 520},     /* 'j' */
+    {5, 525},     /* 'k' */
+    {5, 530},     /* 'l' */
+    {5, 535},     /* 'm' */
+    {5, 540},     /* 'n' */
+    {5, 545},     /* 'o' */
+    {5, 550},     /* 'p' */
+    {5, 555},     /* 'q' */
+    {5, 560},     /* 'r' */
+    {5, 565},     /* 's' */
+    {5, 570},     /* 't' */
+    {5, 575},     /* 'u' */
+    {5, 580},     /* 'v' */
+    {5, 585},     /* 'w' */
+    {5, 590},     /* 'x' */
+    {5, 595},     /* 'y' */
+    {5, 600},     /* 'z' */
+    {5, 605},     /* '{' */
+    {5, 610},     /* '|' */
+    {5, 615},     /* '}' */
+    {5, 620},     /* '~' */
+    {5, 625},     /* '\x7F' */
+    {5, 630},     /* '\x80' */
+    {5, 635},     /* '\x81' */
+    {5, 640},     /* '\x82' */
+    {5, 645},     /* '\x83' */
+    {5, 650},     /* '\x84' */
+    {5, 655},     /* '\x85' */
+    {5, 660},     /* '\x86' */
+    {5, 665},     /* '\x87' */
+    {5, 670},     /* '\x88' */
+    {5, 675},     /* '\x89' */
+    {5, 680},     /* '\x8A' */
+    {5, 685},     /* '\x8B' */
+    {5, 690},     /* '\x8C' */
+    {5, 695},     /* '\x8D' */
+    {5, 700},     /* '\x8E' */
+    {5, 705},     /* '\x8F' */
+    {5, 710},     /* '\x90' */
+    {5, 715},     /* '\x91' */
+    {5, 720},     /* '\x92' */
+    {5, 725},     /* '\x93' */
+    {5, 730},     /* '\x94' */
+    {5, 735},     /* '\x95' */
+    {5, 740},     /* '\x96' */
+    {5, 745},     /* '\x97' */
+    {5, 750},     /* '\x98' */
+    {5, 755},     /* '\x99' */
+    {5, 760},     /* '\x9A' */
+    {5, 765},     /* '\x9B' */
+    {5, 770},     /* '\x9C' */
+    {5, 775},     /* '\x9D' */
+    {5, 780},     /* '\x9E' */
+    {5, 785},     /* '\x9F' */
+    {5, 790},     /* '\xA0' */
+    {5, 795},     /* '\xA1' */
+    {5, 800},     /* '\xA2' */
+    {5, 805},     /* '\xA3' */
+    {5, 810},     /* '\xA4' */
+    {5, 815},     /* '\xA5' */
+    {5, 820},     /* '\xA6' */
+    {5, 825},     /* '\xA7' */
+    {5, 830},     /* '\xA8' */
+    {5, 835},     /* '\xA9' */
+    {5, 840},     /* '\xAA' */
+    {5, 845},     /* '\xAB' */
+    {5, 850},     /* '\xAC' */
+    {5, 855},     /* '\xAD' */
+    {5, 860},     /* '\xAE' */
+    {5, 865},     /* '\xAF' */
+    {5, 870},     /* '\xB0' */
+    {5, 875},     /* '\xB1' */
+    {5, 880},     /* '\xB2' */
+    {5, 885},     /* '\xB3' */
+    {5, 890},     /* '\xB4' */
+    {5, 895},     /* '\xB5' */
+    {5, 900},     /* '\xB6' */
+    {5, 905},     /* '\xB7' */
+    {5, 910},     /* '\xB8' */
+    {5, 915},     /* '\xB9' */
+    {5, 920},     /* '\xBA' */
+    {5, 925},     /* '\xBB' */
+    {5, 930},     /* '\xBC' */
+    {5, 935},     /* '\xBD' */
+    {5, 940},     /* '\xBE' */
+    {5, 945},     /* '\xBF' */
+    {5, 950},     /* '\xC0' */
+    {5, 955},     /* '\xC1' */
+    {5, 960},     /* '\xC2' */
+    {5, 965},     /* '\xC3' */
+    {5, 970},     /* '\xC4' */
+    {5, 975},     /* '\xC5' */
+    {5, 915},     /* '\xC6' */
+    {5, 980},     /* '\xC7' */
+    {5, 985},     /* '\xC8' */
+    {5, 990},     /* '\xC9' */
+    {5, 995},     /* '\xCA' */
+    {5, 1000},    /* '\xCB' */
+    {5, 295},     /* '\xCC' */
+    {5, 1005},    /* '\xCD' */
+    {5, 1010},    /* '\xCE' */
+    {5, 930},     /* '\xCF' */
+    {5, 1015},    /* '\xD0' */
+    {5, 900},     /* '\xD1' */
+    {5, 1020},    /* '\xD2' */
+    {5, 1025},    /* '\xD3' */
+    {5, 1030},    /* '\xD4' */
+    {5, 1035},    /* '\xD5' */
+    {5, 1040},    /* '\xD6' */
+    {5, 1045},    /* '\xD7' */
+    {5, 1050},    /* '\xD8' */
+    {5, 1055},    /* '\xD9' */
+    {5, 1060},    /* '\xDA' */
+    {5, 1065},    /* '\xDB' */
+    {5, 1070},    /* '\xDC' */
+    {5, 1075},    /* '\xDD' */
+    {5, 1080},    /* '\xDE' */
+    {5, 1085},    /* '\xDF' */
+    {5, 1090},    /* '\xE0' */
+    {5, 1095},    /* '\xE1' */
+    {5, 1100},    /* '\xE2' */
+    {5, 1105},    /* '\xE3' */
+    {5, 1110},    /* '\xE4' */
+    {5, 1115},    /* '\xE5' */
+    {5, 1120},    /* '\xE6' */
+    {5, 1125},    /* '\xE7' */
+    {5, 1130},    /* '\xE8' */
+    {5, 1135},    /* '\xE9' */
+    {5, 1140},    /* '\xEA' */
+    {5, 1145},    /* '\xEB' */
+    {5, 1150},    /* '\xEC' */
+    {5, 1155},    /* '\xED' */
+    {5, 1160},    /* '\xEE' */
+    {5, 1165},    /* '\xEF' */
+    {5, 1170},    /* '\xF0' */
+    {5, 1175},    /* '\xF1' */
+    {5, 1180},    /* '\xF2' */
+    {5, 1185},    /* '\xF3' */
+    {5, 1190},    /* '\xF4' */
+    {5, 1195},    /* '\xF5' */
+    {5, 1200},    /* '\xF6' */
+    {5, 1205},    /* '\xF7' */
+    {5, 1210},    /* '\xF8' */
+    {5, 1215},    /* '\xF9' */
+    {5, 1220},    /* '\xFA' */
+    {5, 1225},    /* '\xFB' */
+    {5, 1230},    /* '\xFC' */
+    {5, 1235},    /* '\xFD' */
+    {5, 0},       /* '\xFE' */
+    {5, 1240},    /* '\xFF' */
 };
 
 /* Font information for glcd 5x7 */
 const font_info_t glcd_5x7_font_info =
 {
-    7,   /* Character height */
-    1,   /* C */
-    0,   /* Start character */
-    255, /* End character */
+    7,  /* Character height */
+    1,  /* C */
+    0,  /* Start character '\x0' */
+    255,  /* End character '\xFF' */
     glcd_5x7_descriptors, /* Character descriptor array */
-    glcd_5x7_bitmaps,     /* Character bitmap array */
+    glcd_5x7_bitmaps, /* Character bitmap array */
+    NULL, /* Character ranges, contiguous from start to end character */
+    0,  /* Number of ranges */
 };
-
@@ -24,8 +24,12 @@
 
 
 #include "esp_common.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "dmsg.h"
 #include "i2c.h"
+#include "i2c_bus.h"
 #include "oled_fonts.h"
 #include "oled.h"
 
@@ -34,752 +38,3248 @@
  * @name User configurable panel option block
  * @{
  */
-//! @brief Panel 0 type, define to OLED_NOT_CONNECTED if not used.
-#define OLED0_PANEL_TYPE OLED_SSD1306_128x32
-//! @brief I2C address for panel 0
-#define OLED0_ADDR (0x3c << 1)
-//! @brief If panel 0 has external RESET pin, define this as 1
-#define OLED0_USE_RST 1
-//! @brief GPIO MUX for panel 0 RESET pin
-#define OLED0_RST_MUX  PERIPHS_IO_MUX_MTDI_U
-//! @brief GPIO FUNC for panel 0 RESET pin
-#define OLED0_RST_FUNC FUNC_GPIO12
-//! @brief GPIO bit location for panel 0 RESET pin
-#define OLED0_RST_BIT  BIT12
-
-//! @brief Panel 1 type, define to OLED_NOT_CONNECTED if not used.
-#define OLED1_PANEL_TYPE OLED_SSD1306_128x64
-//! @brief I2C address for panel 1
-#define OLED1_ADDR (0x3d << 1)
-//! @brief If panel 1 has external RESET pin, define this as 1
-#define OLED1_USE_RST 0
-//! @brief GPIO MUX for panel 1 RESET pin
-#define OLED1_RST_MUX  PERIPHS_IO_MUX_MTMS_U
-//! @brief GPIO FUNC for panel 1 RESET pin
-#define OLED1_RST_FUNC FUNC_GPIO14
-//! @brief GPIO bit location for panel 1 RESET pin
-#define OLED1_RST_BIT  BIT14
+//! @brief Panels, one { type, I2C address, I2C SDA lane, RESET pin } entry per panel ID. The
+//!        type is one of the OLED_xxx panel types below. The lane is an SDA lane of I2C_DUAL_LANE
+//!        in i2c.c; with panels 0 and 1 on different lanes oled_refresh_dual() refreshes both at
+//!        the same time. The RESET pin is given as { GPIO MUX, GPIO FUNC, GPIO number }, use
+//!        OLED_NO_RST if the panel has no RESET line. Use OLED_NOT_CONNECTED to keep an ID free.
+#define OLED_PANELS \
+    { OLED_SSD1306_128x32, (0x3c << 1), 0, { PERIPHS_IO_MUX_MTDI_U, FUNC_GPIO12, 12 } }, \
+    { OLED_SSD1306_128x64, (0x3d << 1), 0, OLED_NO_RST },
+
+//! @brief Maximum data bytes per I2C transaction during refresh. Define to 0 to stream
+//!        the whole refresh window in one transaction, or limit it if other devices
+//!        on the bus need it released periodically.
+#define OLED_REFRESH_BURST 0
+
+//! @brief Refresh transactions carrying more data bytes than this go to the bus manager at bulk
+//!        priority, and let short updates from other tasks go first
+#define OLED_BUS_BULK_BYTES 128
+
+//! @brief Priority of the background refresh task serving double buffered panels
+#define OLED_REFRESH_TASK_PRIO (tskIDLE_PRIORITY + 2)
+
+//! @brief Size of the sprite pool of each panel, see oled_set_sprites()
+#define OLED_MAX_SPRITES 8
+
+//! @brief Depth of the viewport stack of each panel, see oled_push_viewport()
+#define OLED_VIEWPORT_DEPTH 4
+
+//! @brief Width and height shared by all panels in OLED_PANELS, 0 if panel sizes differ. When set,
+//!        buffer addressing in the drawing and refresh paths is compiled for this size, e.g. the
+//!        page stride of a 128 wide panel is a shift. Larger canvases (oled_set_canvas()) are not
+//!        available then.
+#define OLED_FIXED_WIDTH 0
+#define OLED_FIXED_HEIGHT 0
+
+//! @brief Bytes of static memory holding display buffers, 0 to allocate them from heap. Each panel
+//!        in OLED_PANELS takes width * height / 8 bytes, in ID order: 512 + 1024 for the panels
+//!        above. Panel contexts are static as well then, and oled_init() / oled_term() do not touch
+//!        the heap. A slice stays reserved in display list mode, so that mode only saves RAM with 0.
+#define OLED_ARENA_SIZE 1536
 /** @} */
 
 
 #define OLED_NOT_CONNECTED   0  //!< no panel
-#define OLED_SSD1306_128x64  1  //!< 128x32 panel
-#define OLED_SSD1306_128x32  2  //!< 128x64 panel
+#define OLED_SSD1306_128x64  1  //!< SSD1306 128x64 panel
+#define OLED_SSD1306_128x32  2  //!< SSD1306 128x32 panel
+#define OLED_SSD1305_128x64  3  //!< SSD1305 128x64 panel, e.g. UG-2864ASYGG14
+#define OLED_SSD1306_64x48   4  //!< SSD1306 64x48 panel, e.g. 0.66" WEMOS shield
+#define OLED_SSD1306_72x40   5  //!< SSD1306 72x40 panel, 0.42"
+#define OLED_SH1107_128x128  6  //!< SH1107 128x128 panel
 
+#define OLED_NO_RST { 0, 0, 0 } //!< Panel without RESET line
 
+#define OLED_MAX_PAGES      16  //!< Pages (8-row stripes) of the tallest supported panel
+#define OLED_MAX_WIDTH     128  //!< Columns of the widest supported panel
 
-LOCAL void ICACHE_FLASH_ATTR _command(uint8_t adress, uint8_t c)
-{
-    bool ret;
-    i2c_start();
-    ret = i2c_write(adress);
-    if (!ret) // NACK
-        i2c_stop();
-    i2c_write(0x00);    // Co = 0, D/C = 0
-    i2c_write(c);
-    i2c_stop();
-}
 
 
-LOCAL void ICACHE_FLASH_ATTR _data(uint8_t adress, uint8_t d)
+//! @brief Sprite, drawn over the display buffer when the frame is composed
+typedef struct _oled_sprite
 {
-    bool ret;
-    i2c_start();
-    ret = i2c_write(adress);
-    if (!ret) // NACK
-        i2c_stop();
-    i2c_write(0x40);    // Co = 0, D/C = 1
-    i2c_write(d);
-    i2c_stop();
-}
+    const uint8_t *bitmap;  // page-aligned bitmap, NULL if the slot is free
+    const uint8_t *mask;    // pixels of bitmap to draw, NULL for all
+    int16_t x;
+    int16_t y;
+    uint8_t w;
+    uint8_t h;
+    uint8_t z;              // sprites with higher z are drawn on top
+    bool visible;
+} oled_sprite;
+
+
+//! @brief Drawing origin and clip rectangle, in panel coordinates
+typedef struct _oled_view
+{
+    int16_t x;              // Origin of drawing coordinates
+    int16_t y;
+    int16_t left;           // Viewport, the clip rectangle can be set anywhere inside it
+    int16_t top;
+    int16_t right;
+    int16_t bottom;
+    int16_t clip_left;      // Clip rectangle, nothing is drawn if left > right or top > bottom
+    int16_t clip_top;
+    int16_t clip_right;
+    int16_t clip_bottom;
+} oled_view;
+
+
+//! @brief Controller and geometry of a panel type
+typedef struct _oled_type
+{
+    uint8_t width;          // Columns
+    uint8_t height;         // Rows, multiple of 8
+    uint8_t ram_pages;      // Display RAM height in pages, the display start line wraps around it
+    uint8_t col_offset;     // Controller RAM column shown in panel column 0
+    bool page_mode;         // Controller has no COLUMNADDR/PAGEADDR window, display RAM is
+                            // addressed one page at a time (SH110x)
+    const uint8_t *init;    // Initialization sequence
+    uint8_t init_len;
+    const uint8_t *off;     // Sequence turning the panel off
+    uint8_t off_len;
+} oled_type;
+
+
+//! @brief Panel connection, see OLED_PANELS
+typedef struct _oled_panel
+{
+    uint8_t type;           // OLED_xxx panel type
+    uint8_t address;        // I2C address
+    uint8_t lane;           // I2C SDA lane
+    struct
+    {
+        uint32_t mux;       // GPIO MUX, 0 if no RESET line
+        uint8_t func;       // GPIO FUNC
+        uint8_t gpio;       // GPIO number
+    } rst;
+} oled_panel;
+
+LOCAL const oled_panel _panels[] = { OLED_PANELS };
+
+//! @brief Number of panel IDs
+#define OLED_NUM_PANELS (sizeof(_panels) / sizeof(_panels[0]))
 
 
 typedef struct _oled_i2c_ctx
 {
-    uint8_t type;       // Panel type
+    const oled_type *type;  // Panel type
     uint8_t address;        // I2C address
-    uint8_t *buffer;        // display buffer
-    uint8_t width;          // panel width (128)
-    uint8_t height;         // panel height (32 or 64)
+    uint8_t lane;           // I2C SDA lane
+    uint8_t *buffer;        // display buffer, or canvas the panel shows a window of
+    uint8_t *home;          // panel sized buffer not from heap (arena or caller's), NULL if none
+    uint8_t *own;           // driver's display buffer while the caller's is attached, else NULL
+    uint8_t width;          // panel width, from type
+    uint8_t height;         // panel height, from type
+    uint16_t canvas_width;  // display buffer size, panel size unless a larger canvas is set
+    uint16_t canvas_height;
+    int16_t win_x;          // Top left of the window of canvas shown on the panel
+    int16_t win_y;
+    uint8_t band_first;     // Pages held in buffer: all pages, or the page being rendered
+    uint8_t band_last;      // from the display list
     uint8_t id;             // my id
-    uint8_t refresh_top;    // "Dirty" window
-    uint8_t refresh_left;
-    uint8_t refresh_right;
-    uint8_t refresh_bottom;
+    uint8_t dirty_left[OLED_MAX_PAGES];     // "Dirty" column span of each page,
+    uint8_t dirty_right[OLED_MAX_PAGES];    // page is clean if left > right
+    uint32_t refresh_bits;  // I2C bit times spent by last refresh
+    uint8_t *shadow;        // copy of panel RAM for diff refresh, NULL if diff refresh disabled
+    bool shadow_stale;      // panel RAM no longer matches shadow (e.g. after hardware scroll)
+    uint16_t diff_compared; // Diff refresh statistics of last refresh
+    uint16_t diff_changed;
+    uint16_t diff_sent;
+    uint16_t diff_windows;
+    uint8_t *front;         // buffer being sent by refresh task, NULL if double buffering disabled
+    uint8_t front_left[OLED_MAX_PAGES];     // Dirty spans of front buffer
+    uint8_t front_right[OLED_MAX_PAGES];
+    bool front_force;       // refresh whole front buffer
+    xSemaphoreHandle idle;  // given when front buffer is not being sent
+    oled_refresh_cb_t refresh_cb;   // called by refresh task when front buffer is sent
+    void *refresh_arg;
     const font_info_t* font;    // current font
+    uint8_t *list;          // display list, NULL if display list mode disabled
+    uint16_t list_size;     // capacity of display list
+    uint16_t list_len;      // bytes recorded
+    bool list_full;         // commands were dropped since last clear
+    bool replay;            // display list being rendered, drawing goes to buffer
+    const font_info_t *list_font;   // font in effect at start of display list
+    oled_sprite *sprites;   // sprite pool, NULL if sprites disabled
+    uint8_t *frame;         // panel image composed from buffer and sprites, NULL if neither sprites
+                            // nor canvas are used and buffer is sent directly
+    oled_view view;         // current viewport
+    oled_view views[OLED_VIEWPORT_DEPTH];   // viewports saved by oled_push_viewport()
+    uint8_t view_depth;
+    oled_view list_view;    // viewport in effect at start of display list
+    bool console;           // console mode, scrolling moves the display start line
+    uint8_t ring_top;       // display RAM page shown in panel page 0, not 0 only in console mode
+    bool ring_moved;        // ring_top not sent to the panel yet
+    int16_t con_x;          // console cursor: column, and first page of the current line
+    uint8_t con_page;
 } oled_i2c_ctx;
 
-LOCAL oled_i2c_ctx *_ctxs[2] = { NULL };
+LOCAL oled_i2c_ctx *_ctxs[OLED_NUM_PANELS] = { NULL };
+#define _CTX(id) (((id) < OLED_NUM_PANELS) ? _ctxs[id] : NULL)  //!< Context of panel, NULL if not initialized
 
+#if (OLED_ARENA_SIZE != 0)
+LOCAL oled_i2c_ctx _ctx_pool[OLED_NUM_PANELS];      // Panel contexts, one per ID
+LOCAL uint32_t _arena[(OLED_ARENA_SIZE + 3) / 4];   // Display buffers, one slice per ID
+#endif
 
-bool ICACHE_FLASH_ATTR oled_init(uint8_t id)
-{
-    oled_i2c_ctx *ctx = NULL;
+#if (OLED_FIXED_WIDTH != 0)
+#define _WIDTH(ctx) OLED_FIXED_WIDTH        //!< Panel width
+#define _HEIGHT(ctx) OLED_FIXED_HEIGHT      //!< Panel height
+#define _STRIDE(ctx) OLED_FIXED_WIDTH       //!< Bytes from one page of display buffer to the next
+#define _WIN_X(ctx) 0                       //!< Left of the window of canvas shown on the panel
+#define _WIN_Y(ctx) 0                       //!< Top of the window
+#define _CANVAS(ctx) false                  //!< Display buffer is a canvas larger than the panel
+#else
+#define _WIDTH(ctx) ((ctx)->width)
+#define _HEIGHT(ctx) ((ctx)->height)
+#define _STRIDE(ctx) ((ctx)->canvas_width)
+#define _WIN_X(ctx) ((ctx)->win_x)
+#define _WIN_Y(ctx) ((ctx)->win_y)
+#define _CANVAS(ctx) ((_STRIDE(ctx) != (ctx)->width) || ((ctx)->canvas_height != (ctx)->height))
+#endif
 
-    if ((id != 0) && (id != 1))
-        goto oled_init_fail;
+LOCAL xQueueHandle _refresh_queue = NULL;   // IDs of panels with front buffer waiting to be sent
 
-    // free old context (if any)
-    oled_term(id);
+LOCAL uint8_t _page_buf[OLED_MAX_WIDTH];    // Scratch page display lists are rendered into
+LOCAL xSemaphoreHandle _page_lock = NULL;   // Taken while _page_buf is in use
 
-    ctx = zalloc(sizeof(oled_i2c_ctx));
-    if (ctx == NULL)
+
+//! @brief I2C bit times for one transaction of n bytes (address included), START and STOP counted as one bit each
+#define _XFER_BITS(n) (2 + 9 * (n))
+
+LOCAL uint32_t _bus_bits = 0;   // Running count of I2C bit times spent by this driver
+
+
+LOCAL const uint8_t _command_head = 0x00;   // Co = 0, D/C = 0, all following bytes are commands
+LOCAL const uint8_t _data_head = 0x40;      // Co = 0, D/C = 1, all following bytes are data
+
+
+/**
+ * @brief   Send a run of command bytes in one I2C transaction
+ * @param   ctx     Panel context
+ * @param   c       Command bytes, including command parameters
+ * @param   n       Number of command bytes
+ */
+LOCAL void ICACHE_FLASH_ATTR _commands(oled_i2c_ctx *ctx, const uint8_t *c, uint8_t n)
+{
+    i2c_bus_seg_t segs[2] =
     {
-        dmsg_err_puts("Alloc OLED context failed.");
-        goto oled_init_fail;
-    }
-    if (id == 0)
-    {
-#if (OLED0_PANEL_TYPE != 0)
-  #if (OLED0_PANEL_TYPE == OLED_SSD1306_128x64)
-        ctx->type = OLED_SSD1306_128x64;
-        ctx->buffer = zalloc(1024); // 128 * 64 / 8
-        ctx->width = 128;
-        ctx->height = 64;
-  #elif (OLED0_PANEL_TYPE == OLED_SSD1306_128x32)
-        ctx->type = OLED_SSD1306_128x32;
-        ctx->buffer = zalloc(512);  // 128 * 32 / 8
-        ctx->width = 128;
-        ctx->height = 32;
-  #else
-    #error "Panel 0 undefined"
-  #endif
-        if (ctx->buffer == NULL)
-        {
-            dmsg_err_puts("Alloc OLED buffer failed.");
-            goto oled_init_fail;
-        }
-        ctx->address = OLED0_ADDR;
-  #if OLED0_USE_RST
-        // Panel 1 reset
-        PIN_FUNC_SELECT(OLED0_RST_MUX, OLED0_RST_FUNC);
-        GPIO_REG_WRITE(GPIO_OUT_W1TC_ADDRESS, OLED0_RST_BIT);
-        os_delay_us(10000);
-        GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, OLED0_RST_BIT);
-  #endif
-#else
-        dmsg_err_puts("Panel 0 not defined.");
-        goto oled_init_fail;
-#endif
-    }
-    else if (id == 1)
-    {
-#if (OLED1_PANEL_TYPE != 0)
-  #if (OLED1_PANEL_TYPE == OLED_SSD1306_128x64)
-        ctx->type = OLED_SSD1306_128x64;
-        ctx->buffer = zalloc(1024); // 128 * 64 / 8
-        ctx->width = 128;
-        ctx->height = 64;
-  #elif (OLED1_PANEL_TYPE == OLED_SSD1306_128x32)
-        ctx->type = OLED_SSD1306_128x32;
-        ctx->buffer = zalloc(512);  // 128 * 32 / 8
-        ctx->width = 128;
-        ctx->height = 32;
-  #else
-     #error "Unknown Panel 1 type"
-  #endif
-        if (ctx->buffer == NULL)
-        {
-            dmsg_err_puts("Alloc OLED buffer failed.");
-            goto oled_init_fail;
-        }
-        ctx->address = OLED1_ADDR;
-  #if OLED1_USE_RST
-        // Panel 2 reset
-        PIN_FUNC_SELECT(OLED1_RST_MUX, OLED1_RST_FUNC);
-        GPIO_REG_WRITE(GPIO_OUT_W1TC_ADDRESS, OLED1_RST_BIT);
-        os_delay_us(10000);
-        GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, OLED1_RST_BIT);
-  #endif
-#else
-        dmsg_err_puts("Panel 1 not defined.");
-        goto oled_init_fail;
-#endif
+        { I2C_SEG_WRITE, ctx->address, 1, &_command_head, NULL },
+        { I2C_SEG_CONTINUE, 0, n, c, NULL },
+    };
+    if (!i2c_bus_transfer(ctx->lane, I2C_BUS_PRIO_UI, segs, 2))
+    {
+        _bus_bits += _XFER_BITS(1);     // NACK
+        return;
     }
+    _bus_bits += _XFER_BITS(2 + n);
+}
 
-    // Panel initialization
-    // Try send I2C address check if the panel is connected
-    i2c_start();
-    if (!i2c_write(ctx->address))
+
+LOCAL void ICACHE_FLASH_ATTR _command(oled_i2c_ctx *ctx, uint8_t c)
+{
+    _commands(ctx, &c, 1);
+}
+
+
+LOCAL void ICACHE_FLASH_ATTR _data(oled_i2c_ctx *ctx, uint8_t d)
+{
+    i2c_bus_seg_t segs[2] =
     {
-        i2c_stop();
-        dmsg_err_puts("OLED I2C bus not responding.");
-        goto oled_init_fail;
-    }
-    i2c_stop();
+        { I2C_SEG_WRITE, ctx->address, 1, &_data_head, NULL },
+        { I2C_SEG_CONTINUE, 0, 1, &d, NULL },
+    };
+    i2c_bus_transfer(ctx->lane, I2C_BUS_PRIO_UI, segs, 2);
+    _bus_bits += _XFER_BITS(3);
+}
 
-    // Now we assume all sending will be successful
-    if (ctx->type == OLED_SSD1306_128x64)
-    {
-        _command(ctx->address, 0xae); // SSD1306_DISPLAYOFF
-        _command(ctx->address, 0xd5); // SSD1306_SETDISPLAYCLOCKDIV
-        _command(ctx->address, 0x80); // Suggested value 0x80
-        _command(ctx->address, 0xa8); // SSD1306_SETMULTIPLEX
-        _command(ctx->address, 0x3f); // 1/64
-        _command(ctx->address, 0xd3); // SSD1306_SETDISPLAYOFFSET
-        _command(ctx->address, 0x00); // 0 no offset
-        _command(ctx->address, 0x40); // SSD1306_SETSTARTLINE line #0
-        _command(ctx->address, 0x20); // SSD1306_MEMORYMODE
-        _command(ctx->address, 0x00); // 0x0 act like ks0108
-        _command(ctx->address, 0xa1); // SSD1306_SEGREMAP | 1
-        _command(ctx->address, 0xc8); // SSD1306_COMSCANDEC
-        _command(ctx->address, 0xda); // SSD1306_SETCOMPINS
-        _command(ctx->address, 0x12);
-        _command(ctx->address, 0x81); // SSD1306_SETCONTRAST
-        _command(ctx->address, 0xcf);
-        _command(ctx->address, 0xd9); // SSD1306_SETPRECHARGE
-        _command(ctx->address, 0xf1);
-        _command(ctx->address, 0xdb); // SSD1306_SETVCOMDETECT
-        _command(ctx->address, 0x30);
-        _command(ctx->address, 0x8d); // SSD1306_CHARGEPUMP
-        _command(ctx->address, 0x14); // Charge pump on
-        _command(ctx->address, 0x2e); // SSD1306_DEACTIVATE_SCROLL
-        _command(ctx->address, 0xa4); // SSD1306_DISPLAYALLON_RESUME
-        _command(ctx->address, 0xa6); // SSD1306_NORMALDISPLAY
-    }
-    else if (ctx->type == OLED_SSD1306_128x32)
-    {
-        _command(ctx->address, 0xae); // SSD1306_DISPLAYOFF
-        _command(ctx->address, 0xd5); // SSD1306_SETDISPLAYCLOCKDIV
-        _command(ctx->address, 0x80); // Suggested value 0x80
-        _command(ctx->address, 0xa8); // SSD1306_SETMULTIPLEX
-        _command(ctx->address, 0x1f); // 1/32
-        _command(ctx->address, 0xd3); // SSD1306_SETDISPLAYOFFSET
-        _command(ctx->address, 0x00); // 0 no offset
-        _command(ctx->address, 0x40); // SSD1306_SETSTARTLINE line #0
-        _command(ctx->address, 0x8d); // SSD1306_CHARGEPUMP
-        _command(ctx->address, 0x14); // Charge pump on
-        _command(ctx->address, 0x20); // SSD1306_MEMORYMODE
-        _command(ctx->address, 0x00); // 0x0 act like ks0108
-        _command(ctx->address, 0xa1); // SSD1306_SEGREMAP | 1
-        _command(ctx->address, 0xc8); // SSD1306_COMSCANDEC
-        _command(ctx->address, 0xda); // SSD1306_SETCOMPINS
-        _command(ctx->address, 0x02);
-        _command(ctx->address, 0x81); // SSD1306_SETCONTRAST
-        _command(ctx->address, 0x2f);
-        _command(ctx->address, 0xd9); // SSD1306_SETPRECHARGE
-        _command(ctx->address, 0xf1);
-        _command(ctx->address, 0xdb); // SSD1306_SETVCOMDETECT
-        _command(ctx->address, 0x40);
-        _command(ctx->address, 0x2e); // SSD1306_DEACTIVATE_SCROLL
-        _command(ctx->address, 0xa4); // SSD1306_DISPLAYALLON_RESUME
-        _command(ctx->address, 0xa6); // SSD1306_NORMALDISPLAY
-    }
-    // Save context
-    ctx->id = id;
-    _ctxs[id] = ctx;
 
-    oled_clear(id);
-    oled_refresh(id, true);
+//! @brief Segments a data stream gathers before handing them to the bus manager, enough for one
+//!        full height window
+#define _STREAM_SEGS (1 + OLED_MAX_PAGES)
 
-    _command(ctx->address, 0xaf); // SSD1306_DISPLAYON
+//! @brief State of a data stream to display RAM. Rows written to the stream are collected as
+//!        segments of one bus transaction, pointing into the caller's buffer.
+typedef struct _oled_stream
+{
+    oled_i2c_ctx *ctx;  // Panel context
+    uint16_t count;     // bytes in current transaction
+    uint8_t nsegs;      // segments in current transaction
+    i2c_bus_seg_t segs[_STREAM_SEGS];
+} oled_stream;
 
-    return true;
 
-oled_init_fail:
-    if (ctx && ctx->buffer) free(ctx->buffer);
-    if (ctx) free(ctx);
-    return false;
+LOCAL void ICACHE_FLASH_ATTR _stream_begin(oled_stream *s, oled_i2c_ctx *ctx)
+{
+    s->ctx = ctx;
+    s->count = 0;
+    s->segs[0].flags = I2C_SEG_WRITE;
+    s->segs[0].address = ctx->address;
+    s->segs[0].len = 1;
+    s->segs[0].wbuf = &_data_head;
+    s->segs[0].rbuf = NULL;
+    s->nsegs = 1;
+    _bus_bits += _XFER_BITS(2);
 }
 
 
-void ICACHE_FLASH_ATTR oled_term(uint8_t id)
+//! @brief Send the gathered transaction. Large transactions give way to short updates from other tasks.
+LOCAL void ICACHE_FLASH_ATTR _stream_flush(oled_stream *s)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    if (ctx == NULL)
-       return;
+    i2c_bus_transfer(s->ctx->lane, (s->count > OLED_BUS_BULK_BYTES) ? I2C_BUS_PRIO_BULK : I2C_BUS_PRIO_UI,
+                     s->segs, s->nsegs);
+}
 
-    _command(ctx->address, 0xae); // SSD_DISPLAYOFF
-    _command(ctx->address, 0x8d); // SSD1306_CHARGEPUMP
-    _command(ctx->address, 0x10); // Charge pump off
 
-    if (ctx->buffer)
-        free(ctx->buffer);
-    free(ctx);
+LOCAL void ICACHE_FLASH_ATTR _stream_write(oled_stream *s, const uint8_t *d, uint16_t n)
+{
+    uint16_t k;
+    i2c_bus_seg_t *seg;
 
-    _ctxs[id] = NULL;
+    while (n)
+    {
+        k = n;
+#if (OLED_REFRESH_BURST != 0)
+        if (s->count == OLED_REFRESH_BURST)
+        {
+            // Release the bus, then continue in a new transaction
+            _stream_flush(s);
+            _stream_begin(s, s->ctx);
+        }
+        if (k > OLED_REFRESH_BURST - s->count)
+            k = OLED_REFRESH_BURST - s->count;
+#endif
+        if (s->nsegs == _STREAM_SEGS)
+        {
+            // Out of segments, display RAM address carries on in the next transaction
+            _stream_flush(s);
+            _stream_begin(s, s->ctx);
+        }
+        seg = s->segs + s->nsegs++;
+        seg->flags = I2C_SEG_CONTINUE;
+        seg->address = 0;
+        seg->len = k;
+        seg->wbuf = d;
+        seg->rbuf = NULL;
+        s->count += k;
+        _bus_bits += 9 * k;
+        d += k;
+        n -= k;
+    }
 }
 
 
-uint8_t ICACHE_FLASH_ATTR oled_get_width(uint8_t id)
+LOCAL void ICACHE_FLASH_ATTR _stream_end(oled_stream *s)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    if (ctx == NULL)
-       return 0;
-
-    return ctx->width;
+    _stream_flush(s);
 }
 
 
-uint8_t ICACHE_FLASH_ATTR oled_get_height(uint8_t id)
+//! @brief SSD1306 128x64 initialization sequence
+LOCAL const uint8_t _init_128x64[] =
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    if (ctx == NULL)
-       return 0;
+    0xae,  // SSD1306_DISPLAYOFF
+    0xd5,  // SSD1306_SETDISPLAYCLOCKDIV
+    0x80,  // Suggested value 0x80
+    0xa8,  // SSD1306_SETMULTIPLEX
+    0x3f,  // 1/64
+    0xd3,  // SSD1306_SETDISPLAYOFFSET
+    0x00,  // 0 no offset
+    0x40,  // SSD1306_SETSTARTLINE line #0
+    0x20,  // SSD1306_MEMORYMODE
+    0x00,  // 0x0 act like ks0108
+    0xa1,  // SSD1306_SEGREMAP | 1
+    0xc8,  // SSD1306_COMSCANDEC
+    0xda,  // SSD1306_SETCOMPINS
+    0x12,
+    0x81,  // SSD1306_SETCONTRAST
+    0xcf,
+    0xd9,  // SSD1306_SETPRECHARGE
+    0xf1,
+    0xdb,  // SSD1306_SETVCOMDETECT
+    0x30,
+    0x8d,  // SSD1306_CHARGEPUMP
+    0x14,  // Charge pump on
+    0x2e,  // SSD1306_DEACTIVATE_SCROLL
+    0xa4,  // SSD1306_DISPLAYALLON_RESUME
+    0xa6,  // SSD1306_NORMALDISPLAY
+};
+
+
+//! @brief SSD1306 128x32 initialization sequence
+LOCAL const uint8_t _init_128x32[] =
+{
+    0xae,  // SSD1306_DISPLAYOFF
+    0xd5,  // SSD1306_SETDISPLAYCLOCKDIV
+    0x80,  // Suggested value 0x80
+    0xa8,  // SSD1306_SETMULTIPLEX
+    0x1f,  // 1/32
+    0xd3,  // SSD1306_SETDISPLAYOFFSET
+    0x00,  // 0 no offset
+    0x40,  // SSD1306_SETSTARTLINE line #0
+    0x8d,  // SSD1306_CHARGEPUMP
+    0x14,  // Charge pump on
+    0x20,  // SSD1306_MEMORYMODE
+    0x00,  // 0x0 act like ks0108
+    0xa1,  // SSD1306_SEGREMAP | 1
+    0xc8,  // SSD1306_COMSCANDEC
+    0xda,  // SSD1306_SETCOMPINS
+    0x02,
+    0x81,  // SSD1306_SETCONTRAST
+    0x2f,
+    0xd9,  // SSD1306_SETPRECHARGE
+    0xf1,
+    0xdb,  // SSD1306_SETVCOMDETECT
+    0x40,
+    0x2e,  // SSD1306_DEACTIVATE_SCROLL
+    0xa4,  // SSD1306_DISPLAYALLON_RESUME
+    0xa6,  // SSD1306_NORMALDISPLAY
+};
+
+
+
+
+//! @brief SSD1305 128x64 initialization sequence, adjusted to UG-2864ASYGG14
+LOCAL const uint8_t _init_ssd1305_128x64[] =
+{
+    0xae,  // SSD1305_DISPLAYOFF
+    0x2e,  // SSD1305_DEACTIVATE_SCROLL
+    0x40,  // SSD1305_SETSTARTLINE line #0
+    0x20,  // SSD1305_MEMORYMODE
+    0x00,  // 0x00 act like ks0108
+    0xd8,  // Mono mode & Normal Display
+    0x00,
+    0x91,  // SSD1305_SETLUT
+    0x31,  // BANK0
+    0x3f,  // Color A
+    0x3f,  // Color B
+    0x3f,  // Color C
+    0x81,  // SSD1305_SETCONTRAST1
+    0x80,
+    0x82,  // SSD1305_SETCONTRAST2
+    0x80,
+    0xa1,  // SSD1305_SEGREMAP | 1
+    0xa4,  // SSD1305_DISPLAYALLON_RESUME
+    0xa6,  // SSD1305_NORMALDISPLAY
+    0xa8,  // SSD1305_SETMULTIPLEX
+    0x3f,  // 1/64
+    0xad,  // External VCC
+    0x8e,
+    0xc8,  // SSD1305_COMSCANDEC
+    0xd3,  // SSD1305_SETDISPLAYOFFSET
+    0x00,  // 0 no offset
+    0xd5,  // SSD1305_SETDISPLAYCLOCKDIV
+    0x70,  // Suggested value 0x70
+    0xd9,  // SSD1305_SETPRECHARGE
+    0xf2,
+    0xda,  // SSD1305_SETCOMPINS
+    0x12,
+    0xdb,  // SSD1305_SETVCOMDETECT
+    0x34,
+};
+
+
+//! @brief SSD1306 64x48 initialization sequence
+LOCAL const uint8_t _init_64x48[] =
+{
+    0xae,  // SSD1306_DISPLAYOFF
+    0xd5,  // SSD1306_SETDISPLAYCLOCKDIV
+    0x80,  // Suggested value 0x80
+    0xa8,  // SSD1306_SETMULTIPLEX
+    0x2f,  // 1/48
+    0xd3,  // SSD1306_SETDISPLAYOFFSET
+    0x00,  // 0 no offset
+    0x40,  // SSD1306_SETSTARTLINE line #0
+    0x8d,  // SSD1306_CHARGEPUMP
+    0x14,  // Charge pump on
+    0x20,  // SSD1306_MEMORYMODE
+    0x00,  // 0x0 act like ks0108
+    0xa1,  // SSD1306_SEGREMAP | 1
+    0xc8,  // SSD1306_COMSCANDEC
+    0xda,  // SSD1306_SETCOMPINS
+    0x12,
+    0x81,  // SSD1306_SETCONTRAST
+    0xcf,
+    0xd9,  // SSD1306_SETPRECHARGE
+    0xf1,
+    0xdb,  // SSD1306_SETVCOMDETECT
+    0x40,
+    0x2e,  // SSD1306_DEACTIVATE_SCROLL
+    0xa4,  // SSD1306_DISPLAYALLON_RESUME
+    0xa6,  // SSD1306_NORMALDISPLAY
+};
+
+
+//! @brief SSD1306 72x40 initialization sequence
+LOCAL const uint8_t _init_72x40[] =
+{
+    0xae,  // SSD1306_DISPLAYOFF
+    0xd5,  // SSD1306_SETDISPLAYCLOCKDIV
+    0x80,  // Suggested value 0x80
+    0xa8,  // SSD1306_SETMULTIPLEX
+    0x27,  // 1/40
+    0xd3,  // SSD1306_SETDISPLAYOFFSET
+    0x00,  // 0 no offset
+    0x40,  // SSD1306_SETSTARTLINE line #0
+    0x8d,  // SSD1306_CHARGEPUMP
+    0x14,  // Charge pump on
+    0x20,  // SSD1306_MEMORYMODE
+    0x00,  // 0x0 act like ks0108
+    0xa1,  // SSD1306_SEGREMAP | 1
+    0xc8,  // SSD1306_COMSCANDEC
+    0xda,  // SSD1306_SETCOMPINS
+    0x12,
+    0xad,  // SSD1306_SETIREF
+    0x30,  // Internal IREF, 240uA
+    0x81,  // SSD1306_SETCONTRAST
+    0xaf,
+    0xd9,  // SSD1306_SETPRECHARGE
+    0x22,
+    0xdb,  // SSD1306_SETVCOMDETECT
+    0x20,
+    0x2e,  // SSD1306_DEACTIVATE_SCROLL
+    0xa4,  // SSD1306_DISPLAYALLON_RESUME
+    0xa6,  // SSD1306_NORMALDISPLAY
+};
+
+
+//! @brief SH1107 128x128 initialization sequence
+LOCAL const uint8_t _init_sh1107_128x128[] =
+{
+    0xae,  // SH1107_DISPLAYOFF
+    0xd5,  // SH1107_SETDISPLAYCLOCKDIV
+    0x51,
+    0x20,  // SH1107_MEMORYMODE page addressing
+    0x81,  // SH1107_SETCONTRAST
+    0x4f,
+    0xad,  // SH1107_DCDC
+    0x8a,  // DC-DC off
+    0xa0,  // SH1107_SEGREMAP
+    0xc0,  // SH1107_COMSCANINC
+    0xdc,  // SH1107_SETDISPSTARTLINE
+    0x00,  // line #0
+    0xd3,  // SH1107_SETDISPLAYOFFSET
+    0x00,  // 0 no offset
+    0xd9,  // SH1107_SETPRECHARGE
+    0x22,
+    0xdb,  // SH1107_SETVCOMDETECT
+    0x35,
+    0xa8,  // SH1107_SETMULTIPLEX
+    0x7f,  // 1/128
+    0xa4,  // SH1107_DISPLAYALLON_RESUME
+    0xa6,  // SH1107_NORMALDISPLAY
+};
+
+
+//! @brief SSD1306 off sequence, charge pump off
+LOCAL const uint8_t _off_ssd1306[] =
+{
+    0xae,  // SSD1306_DISPLAYOFF
+    0x8d,  // SSD1306_CHARGEPUMP
+    0x10,  // Charge pump off
+};
 
-    return ctx->height;
-}
+
+//! @brief SSD1305 and SH1107 off sequence, VCC is external
+LOCAL const uint8_t _off_display[] =
+{
+    0xae,  // DISPLAYOFF
+};
 
 
-void ICACHE_FLASH_ATTR oled_clear(uint8_t id)
+#define _SEQ(t) (t), sizeof(t)
+
+//! @brief Panel types, indexed by OLED_xxx
+LOCAL const oled_type _types[] =
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    if (ctx == NULL)
-        return;
+    [OLED_SSD1306_128x64] = { 128,  64,  8,  0, false, _SEQ(_init_128x64), _SEQ(_off_ssd1306) },
+    [OLED_SSD1306_128x32] = { 128,  32,  8,  0, false, _SEQ(_init_128x32), _SEQ(_off_ssd1306) },
+    [OLED_SSD1305_128x64] = { 128,  64,  8,  2, false, _SEQ(_init_ssd1305_128x64), _SEQ(_off_display) },
+    [OLED_SSD1306_64x48]  = {  64,  48,  8, 32, false, _SEQ(_init_64x48), _SEQ(_off_ssd1306) },
+    [OLED_SSD1306_72x40]  = {  72,  40,  8, 28, false, _SEQ(_init_72x40), _SEQ(_off_ssd1306) },
+    [OLED_SH1107_128x128] = { 128, 128, 16,  0, true, _SEQ(_init_sh1107_128x128), _SEQ(_off_display) },
+};
 
-    if (ctx->type == OLED_SSD1306_128x64)
-    {
-        memset(ctx->buffer, 0, 1024);
-    }
-    else if (ctx->type == OLED_SSD1306_128x32)
+
+//! @brief Bit times to address one refresh window: COLUMNADDR/PAGEADDR batch plus data transaction framing
+#define _WINDOW_COST (_XFER_BITS(8) + _XFER_BITS(2))
+//! @brief Longest run of unchanged bytes that is cheaper to resend than to open a new window for
+#define _MERGE_GAP (_WINDOW_COST / 9)
+
+
+/**
+ * @brief   Mark a rectangle (already clipped to the panel) dirty
+ */
+LOCAL void ICACHE_FLASH_ATTR _mark_dirty(oled_i2c_ctx *ctx, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom)
+{
+    uint8_t p;
+    for (p = top / 8; p <= bottom / 8; ++p)
     {
-        memset(ctx->buffer, 0, 512);
+        if (ctx->dirty_left[p] > left) ctx->dirty_left[p] = left;
+        if (ctx->dirty_right[p] < right) ctx->dirty_right[p] = right;
     }
-    ctx->refresh_right = ctx->width - 1;
-    ctx->refresh_bottom = ctx->height - 1;
-    ctx->refresh_top = 0;
-    ctx->refresh_left = 0;
 }
 
 
-void ICACHE_FLASH_ATTR oled_refresh(uint8_t id, bool force)
+LOCAL void ICACHE_FLASH_ATTR _mark_clean(oled_i2c_ctx *ctx)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint8_t i,j;
-    uint16_t k;
-    uint8_t page_start, page_end;
+    memset(ctx->dirty_left, 255, OLED_MAX_PAGES);
+    memset(ctx->dirty_right, 0, OLED_MAX_PAGES);
+}
 
-    if (ctx == NULL)
-        return;
 
-    if (force)
+/**
+ * @brief   Point display RAM address at a window of the panel. Data sent next fills the window
+ *          left to right, then top to bottom.
+ * @remark  Page mode controllers only take the page and the first column, and do not wrap to the
+ *          next page: send one page at a time.
+ * @remark  In console mode the window must not wrap around the end of display RAM.
+ */
+LOCAL void ICACHE_FLASH_ATTR _address(oled_i2c_ctx *ctx, uint8_t page_start, uint8_t page_end, uint8_t left, uint8_t right)
+{
+    uint8_t col = left + ctx->type->col_offset;
+    if (ctx->ring_top)
     {
-        if (ctx->type == OLED_SSD1306_128x64)
-        {
-            _command(ctx->address, 0x21); // SSD1306_COLUMNADDR
-            _command(ctx->address, 0);    // column start
-            _command(ctx->address, 127);  // column end
-            _command(ctx->address, 0x22); // SSD1306_PAGEADDR
-            _command(ctx->address, 0);    // page start
-            _command(ctx->address, 7);    // page end (8 pages for 64 rows OLED)
-            for (k = 0; k < 1024; k++)
-            {
-                i2c_start();
-                i2c_write(ctx->address);
-                i2c_write(0x40);
-                for (j = 0; j < 16; ++j)
-                {
-                    i2c_write(ctx->buffer[k]);
-                    ++k;
-                }
-                --k;
-                i2c_stop();
-            }
-        }
-        else if (ctx->type == OLED_SSD1306_128x32)
+        // Console mode, panel pages sit on a ring of display RAM pages
+        page_start = (page_start + ctx->ring_top) % ctx->type->ram_pages;
+        page_end = (page_end + ctx->ring_top) % ctx->type->ram_pages;
+    }
+    if (ctx->type->page_mode)
+    {
+        const uint8_t cmds[] =
         {
-            _command(ctx->address, 0x21); // SSD1306_COLUMNADDR
-            _command(ctx->address, 0);    // column start
-            _command(ctx->address, 127);  // column end
-            _command(ctx->address, 0x22); // SSD1306_PAGEADDR
-            _command(ctx->address, 0);    // page start
-            _command(ctx->address, 3);    // page end (4 pages for 32 rows OLED)
-            for (k = 0; k < 512; k++)
-            {
-                i2c_start();
-                i2c_write(ctx->address);
-                i2c_write(0x40);
-                for (j = 0; j < 16; ++j)
-                {
-                    i2c_write(ctx->buffer[k]);
-                    ++k;
-                }
-                --k;
-                i2c_stop();
-            }
-        }
+            0xb0 | page_start,  // SH1107_SETPAGE
+            col & 0x0f,         // SH1107_SETLOWCOLUMN
+            0x10 | (col >> 4),  // SH1107_SETHIGHCOLUMN
+        };
+        _commands(ctx, cmds, sizeof(cmds));
     }
     else
     {
-        if ((ctx->refresh_top <= ctx->refresh_bottom) && (ctx->refresh_left <= ctx->refresh_right))
+        const uint8_t cmds[] =
         {
-            page_start = ctx->refresh_top / 8;
-            page_end = ctx->refresh_bottom / 8;
-            _command(ctx->address, 0x21); // SSD1306_COLUMNADDR
-            _command(ctx->address, ctx->refresh_left);    // column start
-            _command(ctx->address, ctx->refresh_right);   // column end
-            _command(ctx->address, 0x22); // SSD1306_PAGEADDR
-            _command(ctx->address, page_start);    // page start
-            _command(ctx->address, page_end); // page end
-            k = 0;
-            for (i = page_start; i <= page_end; ++i)
-            {
-                for (j = ctx->refresh_left; j <= ctx->refresh_right; ++j)
-                {
-                    if (k == 0)
-                    {
-                        i2c_start();
-                        i2c_write(ctx->address);
-                        i2c_write(0x40);
-                    }
-                    i2c_write(ctx->buffer[i * ctx->width + j]);
-                    ++k;
-                    if (k == 16)
-                    {
-                        i2c_stop();
-                        k = 0;
-                    }
+            0x21,                               // SSD1306_COLUMNADDR
+            col,                                // column start
+            right + ctx->type->col_offset,      // column end
+            0x22,                               // SSD1306_PAGEADDR
+            page_start,                         // page start
+            page_end,                           // page end
+        };
+        _commands(ctx, cmds, sizeof(cmds));
+    }
+}
 
-                }
-            }
-            if (k != 0) // for last batch if stop was not sent
-                i2c_stop();
+
+/**
+ * @brief   Send a window of display buffer to the panel
+ * @param   ctx         Panel context
+ * @param   buf         Display buffer
+ * @param   page_start  First page of the window
+ * @param   page_end    Last page of the window
+ * @param   left        First column of the window
+ * @param   right       Last column of the window
+ */
+LOCAL void ICACHE_FLASH_ATTR _send_window(oled_i2c_ctx *ctx, const uint8_t *buf, uint8_t page_start, uint8_t page_end, uint8_t left, uint8_t right)
+{
+    oled_stream s;
+    uint8_t i;
+    if (ctx->type->page_mode)
+    {
+        for (i = page_start; i <= page_end; ++i)
+        {
+            _address(ctx, i, i, left, right);
+            _stream_begin(&s, ctx);
+            _stream_write(&s, buf + i * _WIDTH(ctx) + left, right - left + 1);
+            _stream_end(&s);
         }
+        return;
+    }
+    if ((page_start + ctx->ring_top < ctx->type->ram_pages) && (page_end + ctx->ring_top >= ctx->type->ram_pages))
+    {
+        // Window wraps around the end of display RAM, send it as two
+        i = ctx->type->ram_pages - ctx->ring_top;
+        _send_window(ctx, buf, page_start, i - 1, left, right);
+        _send_window(ctx, buf, i, page_end, left, right);
+        return;
+    }
+    _address(ctx, page_start, page_end, left, right);
+    _stream_begin(&s, ctx);
+    for (i = page_start; i <= page_end; ++i)
+        _stream_write(&s, buf + i * _WIDTH(ctx) + left, right - left + 1);
+    _stream_end(&s);
+}
+
+
+/**
+ * @brief   Wait until refresh task finished sending front buffer (if double buffered)
+ */
+LOCAL void ICACHE_FLASH_ATTR _wait_idle(oled_i2c_ctx *ctx)
+{
+    if (ctx->front)
+    {
+        xSemaphoreTake(ctx->idle, portMAX_DELAY);
+        xSemaphoreGive(ctx->idle);
     }
-    // reset dirty area
-    ctx->refresh_top = 255;
-    ctx->refresh_left = 255;
-    ctx->refresh_right = 0;
-    ctx->refresh_bottom = 0;
 }
 
 
-void ICACHE_FLASH_ATTR oled_draw_pixel(uint8_t id, int8_t x, int8_t y, oled_color_t color)
+/*
+ * Display list mode. The panel has no display buffer: drawing functions append a command to the
+ * display list, and refresh renders the list one page at a time into _page_buf, sending each page
+ * before the next one is rendered.
+ */
+
+//! @brief Display list opcodes, each followed by its arguments. Coordinates and sizes take two bytes,
+//!        low byte first, other arguments one byte.
+enum
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint16_t index;
+    _OP_PIXEL = 1,      // x, y, color
+    _OP_HLINE,          // x, y, w, color
+    _OP_VLINE,          // x, y, h, color
+    _OP_LINE,           // x0, y0, x1, y1, color
+    _OP_RECT,           // x, y, w, h, color
+    _OP_FILL_RECT,      // x, y, w, h, color
+    _OP_CIRCLE,         // x0, y0, r, color
+    _OP_FILL_CIRCLE,    // x0, y0, r, color
+    _OP_FONT,           // font index
+    _OP_CHAR,           // x, y, code point low, code point high, foreground, background
+    _OP_TEXT,           // x, y, foreground, background, zero terminated UTF-8 string
+    _OP_BITMAP,         // x, y, w (1 byte), h (1 byte), format, rop, bitmap pointer, mask pointer
+    _OP_VIEW,           // oled_view
+};
+
+//! @brief Coordinate as display list bytes
+#define _C16(v) (uint8_t)(v), (uint8_t)((uint16_t)(v) >> 8)
+//! @brief Coordinate from display list bytes
+#define _GET16(p) ((int16_t)((p)[0] | ((p)[1] << 8)))
+
+//! @brief Drawing on this panel is recorded rather than painted
+#define _RECORDING(ctx) ((ctx)->list && !(ctx)->replay)
 
-    if (ctx == NULL)
-        return;
 
-    if ((x >= ctx->width) || (x < 0) || (y >= ctx->height) || (y < 0))
+/**
+ * @brief   Mark a rectangle dirty, clipping it to the panel
+ */
+LOCAL void ICACHE_FLASH_ATTR _mark_region(oled_i2c_ctx *ctx, int16_t left, int16_t top, int16_t right, int16_t bottom)
+{
+    uint8_t p;
+
+    if (left < 0) left = 0;
+    if (top < 0) top = 0;
+    if (right >= _WIDTH(ctx)) right = _WIDTH(ctx) - 1;
+    if (bottom >= _HEIGHT(ctx)) bottom = _HEIGHT(ctx) - 1;
+    if ((left > right) || (top > bottom))
         return;
+    for (p = top / 8; p <= bottom / 8; ++p)
+    {
+        if (ctx->dirty_left[p] > left) ctx->dirty_left[p] = left;
+        if (ctx->dirty_right[p] < right) ctx->dirty_right[p] = right;
+    }
+}
 
-    index = x + (y / 8) * ctx->width;
-    switch (color)
+
+/**
+ * @brief   Mark a rectangle painted into display buffer dirty, as far as it is inside the window
+ */
+LOCAL void ICACHE_FLASH_ATTR _mark_drawn(oled_i2c_ctx *ctx, int16_t left, int16_t top, int16_t right, int16_t bottom)
+{
+    _mark_region(ctx, left - _WIN_X(ctx), top - _WIN_Y(ctx), right - _WIN_X(ctx), bottom - _WIN_Y(ctx));
+}
+
+
+//! @brief Set viewport to the whole display buffer
+LOCAL void ICACHE_FLASH_ATTR _view_reset(oled_i2c_ctx *ctx, oled_view *v)
+{
+    v->x = v->y = 0;
+    v->left = v->clip_left = 0;
+    v->top = v->clip_top = 0;
+    v->right = v->clip_right = ctx->canvas_width - 1;
+    v->bottom = v->clip_bottom = ctx->canvas_height - 1;
+}
+
+
+/**
+ * @brief   Clip a rectangle on the panel to the clip rectangle and to the pages held in display buffer
+ * @return  false if nothing is left to draw
+ */
+LOCAL bool ICACHE_FLASH_ATTR _clip_rect(oled_i2c_ctx *ctx, int16_t *left, int16_t *top, int16_t *right, int16_t *bottom)
+{
+    if (*left < ctx->view.clip_left) *left = ctx->view.clip_left;
+    if (*right > ctx->view.clip_right) *right = ctx->view.clip_right;
+    if (*top < ctx->view.clip_top) *top = ctx->view.clip_top;
+    if (*top < ctx->band_first * 8) *top = ctx->band_first * 8;
+    if (*bottom > ctx->view.clip_bottom) *bottom = ctx->view.clip_bottom;
+    if (*bottom >= (ctx->band_last + 1) * 8) *bottom = (ctx->band_last + 1) * 8 - 1;
+    return (*left <= *right) && (*top <= *bottom);
+}
+
+
+//! @brief Rows top to bottom that fall into page, as a display byte mask
+LOCAL uint8_t ICACHE_FLASH_ATTR _page_rows(int16_t page, int16_t top, int16_t bottom)
+{
+    uint8_t mask = 0xff;
+
+    if ((page < top / 8) || (page > bottom / 8))
+        return 0;
+    if (page == top / 8)
+        mask &= 0xff << (top & 7);
+    if (page == bottom / 8)
+        mask &= 0xff >> (7 - (bottom & 7));
+    return mask;
+}
+
+
+/**
+ * @brief   Mark a rectangle in drawing coordinates dirty, clipping it to the clip rectangle
+ */
+LOCAL void ICACHE_FLASH_ATTR _mark_view(oled_i2c_ctx *ctx, int16_t left, int16_t top, int16_t right, int16_t bottom)
+{
+    left += ctx->view.x;
+    right += ctx->view.x;
+    top += ctx->view.y;
+    bottom += ctx->view.y;
+    if (left < ctx->view.clip_left) left = ctx->view.clip_left;
+    if (right > ctx->view.clip_right) right = ctx->view.clip_right;
+    if (top < ctx->view.clip_top) top = ctx->view.clip_top;
+    if (bottom > ctx->view.clip_bottom) bottom = ctx->view.clip_bottom;
+    if ((left <= right) && (top <= bottom))
+        _mark_dirty(ctx, left, top, right, bottom);
+}
+
+
+/**
+ * @brief   Append room for a command to the display list
+ * @return  Start of the room, NULL if the list is full and the command has to be dropped
+ */
+LOCAL uint8_t * ICACHE_FLASH_ATTR _reserve(oled_i2c_ctx *ctx, uint16_t n)
+{
+    uint8_t *d;
+
+    if ((uint32_t)ctx->list_len + n > ctx->list_size)
     {
-    case OLED_COLOR_WHITE:
-        ctx->buffer[index] |= (1 << (y & 7));
-        break;
-    case OLED_COLOR_BLACK:
-        ctx->buffer[index] &= ~(1 << (y & 7));
-        break;
-    case OLED_COLOR_INVERT:
-        ctx->buffer[index] ^= (1 << (y & 7));
-        break;
+        if (!ctx->list_full)
+            dmsg_err_puts("OLED display list full.");
+        ctx->list_full = true;
+        return NULL;
     }
-    if (ctx->refresh_left > x) ctx->refresh_left = x;
-    if (ctx->refresh_right < x) ctx->refresh_right = x;
-    if (ctx->refresh_top > y) ctx->refresh_top = y;
-    if (ctx->refresh_bottom < y) ctx->refresh_bottom = y;
+    d = ctx->list + ctx->list_len;
+    ctx->list_len += n;
+    return d;
 }
 
 
-void ICACHE_FLASH_ATTR oled_draw_hline(uint8_t id, int8_t x, int8_t y, uint8_t w, oled_color_t color)
+/**
+ * @brief   Record a command and mark the rectangle it draws into dirty
+ */
+LOCAL void ICACHE_FLASH_ATTR _record(oled_i2c_ctx *ctx, const uint8_t *op, uint8_t n,
+                                     int16_t left, int16_t top, int16_t right, int16_t bottom)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint16_t index;
-    uint8_t mask, t;
+    uint8_t *d = _reserve(ctx, n);
 
-    if (ctx == NULL)
+    if (d == NULL)
         return;
-    // boundary check
-    if ((x >= ctx->width) || (x < 0) || (y >= ctx->height) || (y < 0))
+    memcpy(d, op, n);
+    _mark_view(ctx, left, top, right, bottom);
+}
+
+
+//! @brief Record the current viewport, drawing recorded after it is replayed in the same viewport
+LOCAL void ICACHE_FLASH_ATTR _record_view(oled_i2c_ctx *ctx)
+{
+    uint8_t *d;
+
+    if (!_RECORDING(ctx))
         return;
-    if (w == 0)
+    d = _reserve(ctx, 1 + sizeof(oled_view));
+    if (d == NULL)
         return;
-    if (x + w > ctx->width)
-        w = ctx->width - x;
+    d[0] = _OP_VIEW;
+    memcpy(d + 1, &ctx->view, sizeof(oled_view));
+}
 
-    t = w;
-    index = x + (y / 8) * ctx->width;
-    mask = 1 << (y & 7);
-    switch (color)
+
+/**
+ * @brief   Run the display list through the drawing functions, which paint the pages held in
+ *          display buffer (band_first to band_last) and skip the rest
+ */
+LOCAL void ICACHE_FLASH_ATTR _replay(oled_i2c_ctx *ctx)
+{
+    const uint8_t *op = ctx->list;
+    const uint8_t *end = ctx->list + ctx->list_len;
+    const font_info_t *font = ctx->font;
+    const uint8_t *bitmap, *mask;
+    oled_view view = ctx->view;
+    uint8_t id = ctx->id;
+
+    ctx->replay = true;
+    ctx->font = ctx->list_font;
+    ctx->view = ctx->list_view;
+    while (op < end)
     {
-    case OLED_COLOR_WHITE:
-        while (t--)
-        {
-            ctx->buffer[index] |= mask;
-            ++index;
-        }
-        break;
-    case OLED_COLOR_BLACK:
-        mask = ~mask;
-        while (t--)
+        switch (op[0])
         {
-            ctx->buffer[index] &= mask;
-            ++index;
-        }
-        break;
-    case OLED_COLOR_INVERT:
-        while (t--)
+        case _OP_PIXEL:
+            oled_draw_pixel(id, _GET16(op + 1), _GET16(op + 3), (int8_t)op[5]);
+            op += 6;
+            break;
+        case _OP_HLINE:
+            oled_draw_hline(id, _GET16(op + 1), _GET16(op + 3), _GET16(op + 5), (int8_t)op[7]);
+            op += 8;
+            break;
+        case _OP_VLINE:
+            oled_draw_vline(id, _GET16(op + 1), _GET16(op + 3), _GET16(op + 5), (int8_t)op[7]);
+            op += 8;
+            break;
+        case _OP_LINE:
+            oled_draw_line(id, _GET16(op + 1), _GET16(op + 3), _GET16(op + 5), _GET16(op + 7), (int8_t)op[9]);
+            op += 10;
+            break;
+        case _OP_RECT:
+            oled_draw_rectangle(id, _GET16(op + 1), _GET16(op + 3), _GET16(op + 5), _GET16(op + 7), (int8_t)op[9]);
+            op += 10;
+            break;
+        case _OP_FILL_RECT:
+            oled_fill_rectangle(id, _GET16(op + 1), _GET16(op + 3), _GET16(op + 5), _GET16(op + 7), (int8_t)op[9]);
+            op += 10;
+            break;
+        case _OP_CIRCLE:
+            oled_draw_circle(id, _GET16(op + 1), _GET16(op + 3), _GET16(op + 5), (int8_t)op[7]);
+            op += 8;
+            break;
+        case _OP_FILL_CIRCLE:
+            oled_fill_circle(id, _GET16(op + 1), _GET16(op + 3), _GET16(op + 5), (int8_t)op[7]);
+            op += 8;
+            break;
+        case _OP_FONT:
+            ctx->font = oled_fonts[op[1]];
+            op += 2;
+            break;
+        case _OP_CHAR:
+            oled_draw_char(id, _GET16(op + 1), _GET16(op + 3), op[5] | (op[6] << 8), (int8_t)op[7], (int8_t)op[8]);
+            op += 9;
+            break;
+        case _OP_TEXT:
+            oled_draw_string(id, _GET16(op + 1), _GET16(op + 3), (char *)op + 7, (int8_t)op[5], (int8_t)op[6]);
+            op += 7 + strlen((const char *)op + 7) + 1;
+            break;
+        case _OP_BITMAP:
+            memcpy(&bitmap, op + 9, sizeof(bitmap));
+            memcpy(&mask, op + 9 + sizeof(bitmap), sizeof(mask));
+            oled_draw_bitmap(id, _GET16(op + 1), _GET16(op + 3), bitmap, mask, op[5], op[6], op[7], op[8]);
+            op += 9 + sizeof(bitmap) + sizeof(mask);
+            break;
+        case _OP_VIEW:
+            memcpy(&ctx->view, op + 1, sizeof(oled_view));
+            op += 1 + sizeof(oled_view);
+            break;
+        default:
+            op = end;
+            break;
+        }
+    }
+    ctx->font = font;
+    ctx->view = view;
+    ctx->replay = false;
+}
+
+
+/**
+ * @brief   Send columns left to right of one page
+ * @param   ctx     Panel context
+ * @param   row     Display data of the page
+ * @param   page    Page on the panel
+ * @param   left    First column
+ * @param   right   Last column
+ */
+LOCAL void ICACHE_FLASH_ATTR _send_page(oled_i2c_ctx *ctx, const uint8_t *row, uint8_t page, uint8_t left, uint8_t right)
+{
+    oled_stream s;
+    _address(ctx, page, page, left, right);
+    _stream_begin(&s, ctx);
+    _stream_write(&s, row + left, right - left + 1);
+    _stream_end(&s);
+}
+
+
+/**
+ * @brief   Render display list page by page and send the dirty span of each page
+ */
+LOCAL void ICACHE_FLASH_ATTR _refresh_list(oled_i2c_ctx *ctx, bool force)
+{
+    uint8_t left[OLED_MAX_PAGES], right[OLED_MAX_PAGES];
+    uint32_t bits = _bus_bits;
+    uint8_t p;
+
+    // Rendering marks the page it paints, keep the spans to send
+    memcpy(left, ctx->dirty_left, OLED_MAX_PAGES);
+    memcpy(right, ctx->dirty_right, OLED_MAX_PAGES);
+    xSemaphoreTake(_page_lock, portMAX_DELAY);
+    ctx->buffer = _page_buf;
+    for (p = 0; p < _HEIGHT(ctx) / 8; ++p)
+    {
+        if (force)
+        {
+            left[p] = 0;
+            right[p] = _WIDTH(ctx) - 1;
+        }
+        else if (left[p] > right[p])
+        {
+            continue;
+        }
+        memset(_page_buf, 0, _WIDTH(ctx));
+        ctx->band_first = ctx->band_last = p;
+        _replay(ctx);
+        _send_page(ctx, _page_buf, p, left[p], right[p]);
+    }
+    ctx->buffer = NULL;
+    ctx->band_first = 0;
+    ctx->band_last = _HEIGHT(ctx) / 8 - 1;
+    xSemaphoreGive(_page_lock);
+    ctx->refresh_bits = _bus_bits - bits;
+}
+
+
+uint8_t ICACHE_FLASH_ATTR oled_get_panel_count(void)
+{
+    return OLED_NUM_PANELS;
+}
+
+
+/**
+ * @brief   Free a buffer of the panel unless it is the panel's buffer outside heap
+ */
+LOCAL void ICACHE_FLASH_ATTR _free_buffer(oled_i2c_ctx *ctx, uint8_t *buf)
+{
+    if (buf && (buf != ctx->home))
+        free(buf);
+}
+
+
+#if (OLED_ARENA_SIZE != 0)
+/**
+ * @brief   Slice of the arena holding the display buffer of a panel. Slices follow each other in
+ *          ID order, so a panel gets the same slice every time it is initialized.
+ * @return  NULL if the arena is too small
+ */
+LOCAL uint8_t * ICACHE_FLASH_ATTR _arena_slice(uint8_t id)
+{
+    uint32_t offset = 0;
+    uint8_t k;
+
+    for (k = 0; k < id; ++k)
+        offset += _types[_panels[k].type].width * _types[_panels[k].type].height / 8;
+    if (offset + _types[_panels[id].type].width * _types[_panels[id].type].height / 8 > OLED_ARENA_SIZE)
+        return NULL;
+    return (uint8_t *)_arena + offset;
+}
+#endif
+
+
+bool ICACHE_FLASH_ATTR oled_init(uint8_t id)
+{
+    return oled_init_buffer(id, NULL);
+}
+
+
+bool ICACHE_FLASH_ATTR oled_init_buffer(uint8_t id, uint8_t *buffer)
+{
+    oled_i2c_ctx *ctx = NULL;
+    i2c_bus_seg_t probe;
+    const oled_panel *panel;
+
+    if ((id >= OLED_NUM_PANELS) || (_panels[id].type == OLED_NOT_CONNECTED))
+    {
+        dmsg_err_puts("OLED panel not defined.");
+        goto oled_init_fail;
+    }
+    panel = &_panels[id];
+
+    // free old context (if any)
+    oled_term(id);
+
+#if (OLED_ARENA_SIZE != 0)
+    ctx = &_ctx_pool[id];
+    memset(ctx, 0, sizeof(oled_i2c_ctx));
+#else
+    ctx = zalloc(sizeof(oled_i2c_ctx));
+    if (ctx == NULL)
+    {
+        dmsg_err_puts("Alloc OLED context failed.");
+        goto oled_init_fail;
+    }
+#endif
+    ctx->type = &_types[panel->type];
+    ctx->width = ctx->type->width;
+    ctx->height = ctx->type->height;
+#if (OLED_FIXED_WIDTH != 0)
+    if ((ctx->width != OLED_FIXED_WIDTH) || (ctx->height != OLED_FIXED_HEIGHT))
+    {
+        dmsg_err_puts("OLED panel size differs from OLED_FIXED_WIDTH/HEIGHT.");
+        goto oled_init_fail;
+    }
+#endif
+    ctx->home = buffer;
+#if (OLED_ARENA_SIZE != 0)
+    if (ctx->home == NULL)
+    {
+        ctx->home = _arena_slice(id);
+        if (ctx->home == NULL)
+        {
+            dmsg_err_puts("OLED arena too small.");
+            goto oled_init_fail;
+        }
+    }
+#endif
+    if (ctx->home)
+    {
+        ctx->buffer = ctx->home;
+        memset(ctx->buffer, 0, ctx->width * ctx->height / 8);
+    }
+    else
+    {
+        ctx->buffer = zalloc(ctx->width * ctx->height / 8);
+        if (ctx->buffer == NULL)
+        {
+            dmsg_err_puts("Alloc OLED buffer failed.");
+            goto oled_init_fail;
+        }
+    }
+    ctx->address = panel->address;
+    ctx->lane = panel->lane;
+    if (panel->rst.mux)
+    {
+        // Panel reset
+        PIN_FUNC_SELECT(panel->rst.mux, panel->rst.func);
+        GPIO_REG_WRITE(GPIO_OUT_W1TC_ADDRESS, BIT(panel->rst.gpio));
+        os_delay_us(10000);
+        GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, BIT(panel->rst.gpio));
+    }
+
+    ctx->canvas_width = _WIDTH(ctx);
+    ctx->canvas_height = _HEIGHT(ctx);
+    ctx->band_first = 0;
+    ctx->band_last = _HEIGHT(ctx) / 8 - 1;
+    _view_reset(ctx, &ctx->view);
+
+    // Panel initialization
+    // Try send I2C address check if the panel is connected
+    probe.flags = I2C_SEG_WRITE;
+    probe.address = ctx->address;
+    probe.len = 0;
+    probe.wbuf = NULL;
+    probe.rbuf = NULL;
+    if (!i2c_bus_transfer(ctx->lane, I2C_BUS_PRIO_NORMAL, &probe, 1))
+    {
+        dmsg_err_puts("OLED I2C bus not responding.");
+        goto oled_init_fail;
+    }
+
+    // Now we assume all sending will be successful
+    _commands(ctx, ctx->type->init, ctx->type->init_len);
+    // Save context
+    ctx->id = id;
+    _ctxs[id] = ctx;
+
+    oled_clear(id);
+    oled_refresh(id, true);
+
+    _command(ctx, 0xaf); // SSD1306_DISPLAYON
+
+    return true;
+
+oled_init_fail:
+    if (ctx) _free_buffer(ctx, ctx->buffer);
+#if (OLED_ARENA_SIZE == 0)
+    if (ctx) free(ctx);
+#endif
+    return false;
+}
+
+
+void ICACHE_FLASH_ATTR oled_term(uint8_t id)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    if (ctx == NULL)
+       return;
+
+    oled_set_double_buffer(id, false, NULL, NULL);
+    _commands(ctx, ctx->type->off, ctx->type->off_len);
+
+    if (ctx->own)
+        ctx->buffer = ctx->own;
+    _free_buffer(ctx, ctx->buffer);
+    if (ctx->shadow)
+        free(ctx->shadow);
+    if (ctx->list)
+        free(ctx->list);
+    if (ctx->sprites)
+        free(ctx->sprites);
+    if (ctx->frame)
+        free(ctx->frame);
+#if (OLED_ARENA_SIZE == 0)
+    free(ctx);
+#endif
+
+    _ctxs[id] = NULL;
+}
+
+
+uint8_t ICACHE_FLASH_ATTR oled_get_width(uint8_t id)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    if (ctx == NULL)
+       return 0;
+
+    return _WIDTH(ctx);
+}
+
+
+uint8_t ICACHE_FLASH_ATTR oled_get_height(uint8_t id)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    if (ctx == NULL)
+       return 0;
+
+    return _HEIGHT(ctx);
+}
+
+
+void ICACHE_FLASH_ATTR oled_clear(uint8_t id)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    if (ctx == NULL)
+        return;
+
+    if (ctx->list)
+    {
+        // Empty display list draws a black frame
+        ctx->list_len = 0;
+        ctx->list_full = false;
+        ctx->list_font = ctx->font;
+        ctx->list_view = ctx->view;
+    }
+    else
+    {
+        memset(ctx->buffer, 0, (uint32_t)ctx->canvas_width * ctx->canvas_height / 8);
+    }
+    _mark_dirty(ctx, 0, 0, _WIDTH(ctx) - 1, _HEIGHT(ctx) - 1);
+}
+
+
+/**
+ * @brief   Send only bytes that differ from the shadow frame. Changed bytes in each dirty page are
+ *          grouped into runs, runs separated by no more than _MERGE_GAP unchanged bytes are merged.
+ */
+LOCAL void ICACHE_FLASH_ATTR _send_diff(oled_i2c_ctx *ctx, const uint8_t *buf, const uint8_t *dirty_left, const uint8_t *dirty_right)
+{
+    uint8_t p, j, start = 0, end = 0;
+    uint16_t base;
+    bool in_run;
+
+    for (p = 0; p < _HEIGHT(ctx) / 8; ++p)
+    {
+        if (dirty_left[p] > dirty_right[p])
+            continue;
+        base = p * _WIDTH(ctx);
+        in_run = false;
+        for (j = dirty_left[p]; j <= dirty_right[p]; ++j)
+        {
+            ++ctx->diff_compared;
+            if (buf[base + j] == ctx->shadow[base + j])
+            {
+                if (in_run && (j - end > _MERGE_GAP))
+                {
+                    _send_window(ctx, buf, p, p, start, end);
+                    memcpy(ctx->shadow + base + start, buf + base + start, end - start + 1);
+                    ctx->diff_sent += end - start + 1;
+                    ++ctx->diff_windows;
+                    in_run = false;
+                }
+                continue;
+            }
+            ++ctx->diff_changed;
+            if (!in_run)
+            {
+                start = j;
+                in_run = true;
+            }
+            end = j;
+        }
+        if (in_run)
+        {
+            _send_window(ctx, buf, p, p, start, end);
+            memcpy(ctx->shadow + base + start, buf + base + start, end - start + 1);
+            ctx->diff_sent += end - start + 1;
+            ++ctx->diff_windows;
+        }
+    }
+}
+
+
+/**
+ * @brief   Send dirty spans. Pages are collected into windows, a page is folded into the current
+ *          window if resending the (possibly wider) window costs fewer bus bits than addressing
+ *          the page on its own.
+ */
+LOCAL void ICACHE_FLASH_ATTR _send_dirty(oled_i2c_ctx *ctx, const uint8_t *buf, const uint8_t *dirty_left, const uint8_t *dirty_right)
+{
+    uint8_t p;
+    uint8_t page_start = 0, page_end = 0, left = 255, right = 0;
+    uint32_t merged, split;
+
+    for (p = 0; p < _HEIGHT(ctx) / 8; ++p)
+    {
+        if (dirty_left[p] > dirty_right[p])
+            continue;
+        if (left <= right)
+        {
+            split = _WINDOW_COST + 9 * (uint32_t)(page_end - page_start + 1) * (right - left + 1)
+                  + _WINDOW_COST + 9 * (uint32_t)(dirty_right[p] - dirty_left[p] + 1);
+            merged = _WINDOW_COST + 9 * (uint32_t)(p - page_start + 1)
+                   * (((dirty_right[p] > right) ? dirty_right[p] : right)
+                      - ((dirty_left[p] < left) ? dirty_left[p] : left) + 1);
+            if (merged <= split)
+            {
+                page_end = p;
+                if (left > dirty_left[p]) left = dirty_left[p];
+                if (right < dirty_right[p]) right = dirty_right[p];
+                continue;
+            }
+            _send_window(ctx, buf, page_start, page_end, left, right);
+        }
+        page_start = page_end = p;
+        left = dirty_left[p];
+        right = dirty_right[p];
+    }
+    if (left <= right)
+        _send_window(ctx, buf, page_start, page_end, left, right);
+}
+
+
+//! @brief Send display start line, putting display RAM page ring_top at the top of the panel
+LOCAL void ICACHE_FLASH_ATTR _start_line(oled_i2c_ctx *ctx)
+{
+    if (ctx->type->page_mode)
+    {
+        const uint8_t cmds[] =
+        {
+            0xdc,               // SH1107_SETDISPSTARTLINE
+            ctx->ring_top * 8,  // line #
+        };
+        _commands(ctx, cmds, sizeof(cmds));
+    }
+    else
+    {
+        _command(ctx, 0x40 | (ctx->ring_top * 8)); // SSD1306_SETSTARTLINE
+    }
+}
+
+
+/**
+ * @brief   Send a display buffer to the panel
+ * @param   ctx         Panel context
+ * @param   buf         Display buffer
+ * @param   dirty_left  Dirty spans of the buffer
+ * @param   dirty_right
+ * @param   force       Send whole buffer regardless of dirty spans
+ */
+LOCAL void ICACHE_FLASH_ATTR _refresh(oled_i2c_ctx *ctx, const uint8_t *buf, const uint8_t *dirty_left, const uint8_t *dirty_right, bool force)
+{
+    uint32_t bits = _bus_bits;
+
+    ctx->diff_compared = 0;
+    ctx->diff_changed = 0;
+    ctx->diff_sent = 0;
+    ctx->diff_windows = 0;
+    if (ctx->ring_moved && (ctx->type->ram_pages == _HEIGHT(ctx) / 8))
+    {
+        // Display RAM holds just the panel, so pages exposed by console scrolling are still on
+        // screen at the top. Scroll first, rather than overwrite the top lines while they show.
+        _start_line(ctx);
+        ctx->ring_moved = false;
+    }
+    if (force)
+        _send_window(ctx, buf, 0, _HEIGHT(ctx) / 8 - 1, 0, _WIDTH(ctx) - 1);
+    else if (ctx->shadow && !ctx->shadow_stale)
+        _send_diff(ctx, buf, dirty_left, dirty_right);
+    else
+        _send_dirty(ctx, buf, dirty_left, dirty_right);
+    if (ctx->shadow && (force || ctx->shadow_stale))
+    {
+        // Panel RAM now matches display buffer
+        memcpy(ctx->shadow, buf, _WIDTH(ctx) * _HEIGHT(ctx) / 8);
+        ctx->shadow_stale = false;
+    }
+    if (ctx->ring_moved)
+    {
+        // Pages exposed by console scrolling are sent while still off screen, now show them
+        _start_line(ctx);
+        ctx->ring_moved = false;
+    }
+    ctx->refresh_bits = _bus_bits - bits;
+}
+
+
+LOCAL void ICACHE_FLASH_ATTR _refresh_task(void *pvParameters)
+{
+    uint8_t id;
+    oled_i2c_ctx *ctx;
+
+    for (;;)
+    {
+        if (xQueueReceive(_refresh_queue, &id, portMAX_DELAY))
+        {
+            ctx = _ctxs[id];
+            _refresh(ctx, ctx->front, ctx->front_left, ctx->front_right, ctx->front_force);
+            if (ctx->refresh_cb)
+                ctx->refresh_cb(id, ctx->refresh_arg);
+            xSemaphoreGive(ctx->idle);
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+
+/**
+ * @brief   Hand display buffer over to refresh task and continue drawing on the other buffer
+ */
+LOCAL void ICACHE_FLASH_ATTR _swap(oled_i2c_ctx *ctx, bool force)
+{
+    uint8_t p;
+    uint8_t *t;
+
+    // Only blocks if previous front buffer is still being sent
+    xSemaphoreTake(ctx->idle, portMAX_DELAY);
+    t = ctx->front;
+    ctx->front = ctx->buffer;
+    ctx->buffer = t;
+    memcpy(ctx->front_left, ctx->dirty_left, OLED_MAX_PAGES);
+    memcpy(ctx->front_right, ctx->dirty_right, OLED_MAX_PAGES);
+    ctx->front_force = force;
+    // New back buffer holds the previous frame, catch up by copying what changed since
+    for (p = 0; p < _HEIGHT(ctx) / 8; ++p)
+    {
+        if (ctx->dirty_left[p] <= ctx->dirty_right[p])
+            memcpy(ctx->buffer + p * _WIDTH(ctx) + ctx->dirty_left[p],
+                   ctx->front + p * _WIDTH(ctx) + ctx->dirty_left[p],
+                   ctx->dirty_right[p] - ctx->dirty_left[p] + 1);
+    }
+    _mark_clean(ctx);
+    xQueueSend(_refresh_queue, &ctx->id, portMAX_DELAY);
+}
+
+
+LOCAL void _compose(oled_i2c_ctx *ctx, bool force);
+
+
+void ICACHE_FLASH_ATTR oled_refresh(uint8_t id, bool force)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if (ctx == NULL)
+        return;
+
+    if (ctx->list)
+    {
+        _refresh_list(ctx, force);
+        _mark_clean(ctx);
+        return;
+    }
+    if (ctx->frame)
+    {
+        _compose(ctx, force);
+        _refresh(ctx, ctx->frame, ctx->dirty_left, ctx->dirty_right, force);
+        _mark_clean(ctx);
+        return;
+    }
+    if (ctx->front)
+    {
+        _swap(ctx, force);
+        _wait_idle(ctx);
+        return;
+    }
+    _refresh(ctx, ctx->buffer, ctx->dirty_left, ctx->dirty_right, force);
+    // reset dirty area
+    _mark_clean(ctx);
+}
+
+
+//! @brief Lane data of a simultaneous two-panel refresh, handed to the bus manager
+typedef struct _oled_dual_job
+{
+    const i2c_lane_t **cmd;     // Command transaction of each lane
+    const i2c_lane_t **data;    // Data transaction of each lane
+} oled_dual_job;
+
+
+LOCAL void ICACHE_FLASH_ATTR _dual_job(void *arg)
+{
+    oled_dual_job *job = (oled_dual_job *)arg;
+    uint16_t acked[2];
+
+    i2c_dual_write(job->cmd[0], job->cmd[1], acked);
+    i2c_dual_write(job->data[0], job->data[1], acked);
+}
+
+
+void ICACHE_FLASH_ATTR oled_refresh_dual(bool force)
+{
+    oled_i2c_ctx *ctx;
+    uint8_t cmds[2][8], head[2][2];
+    i2c_lane_t cmd_lane[2], data_lane[2];
+    const i2c_lane_t *cmd_lanes[2] = { NULL, NULL }, *data_lanes[2] = { NULL, NULL };
+    oled_dual_job job = { cmd_lanes, data_lanes };
+    uint8_t page_start, page_end, left, right, k, p;
+    uint16_t len = 0;
+
+    if (OLED_NUM_PANELS < 2)
+    {
+        oled_refresh(0, force);
+        return;
+    }
+    if ((_ctxs[0] == NULL) || (_ctxs[1] == NULL) || (_ctxs[0]->lane == _ctxs[1]->lane)
+        || _ctxs[0]->front || _ctxs[1]->front || _ctxs[0]->list || _ctxs[1]->list
+        || _ctxs[0]->frame || _ctxs[1]->frame || _ctxs[0]->type->page_mode || _ctxs[1]->type->page_mode
+        || _ctxs[0]->console || _ctxs[1]->console)
+    {
+        // Not on separate lanes, double buffered, in display list mode, composed into a frame,
+        // without a COLUMNADDR/PAGEADDR window or in console mode
+        oled_refresh(0, force);
+        oled_refresh(1, force);
+        return;
+    }
+
+    for (k = 0; k < 2; ++k)
+    {
+        ctx = _ctxs[k];
+        ctx->diff_compared = 0;
+        ctx->diff_changed = 0;
+        ctx->diff_sent = 0;
+        ctx->diff_windows = 0;
+        ctx->refresh_bits = 0;
+        // One window bounding all dirty pages of this panel
+        page_start = 255;
+        page_end = 0;
+        left = 255;
+        right = 0;
+        for (p = 0; p < _HEIGHT(ctx) / 8; ++p)
+        {
+            if (!force && (ctx->dirty_left[p] > ctx->dirty_right[p]))
+                continue;
+            if (page_start == 255) page_start = p;
+            page_end = p;
+            if (left > ctx->dirty_left[p]) left = ctx->dirty_left[p];
+            if (right < ctx->dirty_right[p]) right = ctx->dirty_right[p];
+        }
+        if (force)
+        {
+            left = 0;
+            right = _WIDTH(ctx) - 1;
+        }
+        if (page_start == 255)
+            continue;
+        cmds[k][0] = ctx->address;
+        cmds[k][1] = 0x00;          // Co = 0, D/C = 0
+        cmds[k][2] = 0x21;          // SSD1306_COLUMNADDR
+        cmds[k][3] = left + ctx->type->col_offset;
+        cmds[k][4] = right + ctx->type->col_offset;
+        cmds[k][5] = 0x22;          // SSD1306_PAGEADDR
+        cmds[k][6] = page_start;
+        cmds[k][7] = page_end;
+        cmd_lane[k].head = cmds[k];
+        cmd_lane[k].head_len = sizeof(cmds[k]);
+        cmd_lane[k].rows = 0;
+        head[k][0] = ctx->address;
+        head[k][1] = 0x40;          // Co = 0, D/C = 1
+        data_lane[k].head = head[k];
+        data_lane[k].head_len = sizeof(head[k]);
+        data_lane[k].buf = ctx->buffer + page_start * _WIDTH(ctx) + left;
+        data_lane[k].len = right - left + 1;
+        data_lane[k].stride = _WIDTH(ctx);
+        data_lane[k].rows = page_end - page_start + 1;
+        cmd_lanes[ctx->lane] = &cmd_lane[k];
+        data_lanes[ctx->lane] = &data_lane[k];
+        if (len < data_lane[k].len * data_lane[k].rows)
+            len = data_lane[k].len * data_lane[k].rows;
+        if (ctx->shadow)
+        {
+            // Keep shadow frame in step with what is sent
+            if (force)
+            {
+                memcpy(ctx->shadow, ctx->buffer, _WIDTH(ctx) * _HEIGHT(ctx) / 8);
+                ctx->shadow_stale = false;
+            }
+            else
+            {
+                for (p = page_start; p <= page_end; ++p)
+                    memcpy(ctx->shadow + p * _WIDTH(ctx) + left, ctx->buffer + p * _WIDTH(ctx) + left, right - left + 1);
+            }
+        }
+    }
+
+    if (cmd_lanes[0] || cmd_lanes[1])
+    {
+        // Both lanes share the clock, so both panels are charged the bus time of the longer one
+        i2c_bus_run((len > OLED_BUS_BULK_BYTES) ? I2C_BUS_PRIO_BULK : I2C_BUS_PRIO_UI, _dual_job, &job);
+        _bus_bits += _XFER_BITS(8) + _XFER_BITS(2 + len);
+        for (k = 0; k < 2; ++k)
+        {
+            if (data_lanes[_ctxs[k]->lane])
+                _ctxs[k]->refresh_bits = _XFER_BITS(8) + _XFER_BITS(2 + len);
+        }
+    }
+    _mark_clean(_ctxs[0]);
+    _mark_clean(_ctxs[1]);
+}
+
+
+uint32_t ICACHE_FLASH_ATTR oled_get_refresh_bits(uint8_t id)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    if (ctx == NULL)
+       return 0;
+
+    return ctx->refresh_bits;
+}
+
+
+bool ICACHE_FLASH_ATTR oled_set_double_buffer(uint8_t id, bool enable, oled_refresh_cb_t cb, void *arg)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    if (ctx == NULL)
+        return false;
+
+    if (!enable)
+    {
+        if (ctx->front)
+        {
+            // Wait for the last front buffer to reach the panel
+            xSemaphoreTake(ctx->idle, portMAX_DELAY);
+            if (ctx->front == ctx->home)
+            {
+                // Keep drawing in the buffer outside heap
+                memcpy(ctx->home, ctx->buffer, _WIDTH(ctx) * _HEIGHT(ctx) / 8);
+                ctx->front = ctx->buffer;
+                ctx->buffer = ctx->home;
+            }
+            free(ctx->front);
+            ctx->front = NULL;
+            vSemaphoreDelete(ctx->idle);
+            ctx->idle = NULL;
+        }
+        ctx->refresh_cb = NULL;
+        ctx->refresh_arg = NULL;
+        return true;
+    }
+    if (ctx->list || ctx->frame || ctx->own || ctx->console)
+    {
+        dmsg_err_puts("OLED double buffering not available in display list or console mode, with sprites, canvas or attached buffer.");
+        return false;
+    }
+    if (ctx->front == NULL)
+    {
+        if (_refresh_queue == NULL)
+        {
+            _refresh_queue = xQueueCreate(4, sizeof(uint8_t));
+            if (_refresh_queue == NULL)
+            {
+                dmsg_err_puts("Create OLED refresh queue failed.");
+                return false;
+            }
+            if (xTaskCreate(_refresh_task, "oled", 256, NULL, OLED_REFRESH_TASK_PRIO, NULL) != pdPASS)
+            {
+                dmsg_err_puts("Create OLED refresh task failed.");
+                vQueueDelete(_refresh_queue);
+                _refresh_queue = NULL;
+                return false;
+            }
+        }
+        ctx->front = zalloc(_WIDTH(ctx) * _HEIGHT(ctx) / 8);
+        if (ctx->front == NULL)
+        {
+            dmsg_err_puts("Alloc OLED front buffer failed.");
+            return false;
+        }
+        vSemaphoreCreateBinary(ctx->idle);
+        if (ctx->idle == NULL)
+        {
+            dmsg_err_puts("Create OLED refresh semaphore failed.");
+            free(ctx->front);
+            ctx->front = NULL;
+            return false;
+        }
+        memcpy(ctx->front, ctx->buffer, _WIDTH(ctx) * _HEIGHT(ctx) / 8);
+    }
+    ctx->refresh_cb = cb;
+    ctx->refresh_arg = arg;
+    return true;
+}
+
+
+void ICACHE_FLASH_ATTR oled_swap(uint8_t id, bool force)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    if (ctx == NULL)
+        return;
+
+    if (ctx->front)
+        _swap(ctx, force);
+    else
+        oled_refresh(id, force);
+}
+
+
+void ICACHE_FLASH_ATTR oled_wait_refresh(uint8_t id)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    if (ctx == NULL)
+        return;
+
+    _wait_idle(ctx);
+}
+
+
+bool ICACHE_FLASH_ATTR oled_set_diff_refresh(uint8_t id, bool enable)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    if (ctx == NULL)
+        return false;
+
+    if (!enable)
+    {
+        _wait_idle(ctx);
+        if (ctx->shadow)
+            free(ctx->shadow);
+        ctx->shadow = NULL;
+        return true;
+    }
+    if (ctx->shadow)
+        return true;
+    if (ctx->list)
+    {
+        dmsg_err_puts("OLED diff refresh not available in display list mode.");
+        return false;
+    }
+    // Flush pending updates so the panel matches display buffer, then take the shadow copy
+    oled_refresh(id, false);
+    ctx->shadow = zalloc(_WIDTH(ctx) * _HEIGHT(ctx) / 8);
+    if (ctx->shadow == NULL)
+    {
+        dmsg_err_puts("Alloc OLED shadow buffer failed.");
+        return false;
+    }
+    memcpy(ctx->shadow, ctx->frame ? ctx->frame : ctx->buffer, _WIDTH(ctx) * _HEIGHT(ctx) / 8);
+    ctx->shadow_stale = false;
+    return true;
+}
+
+
+bool ICACHE_FLASH_ATTR oled_get_diff_stats(uint8_t id, oled_diff_stats_t *stats)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    if ((ctx == NULL) || (ctx->shadow == NULL) || (stats == NULL))
+        return false;
+
+    stats->window_cost = _WINDOW_COST;
+    stats->byte_cost = 9;
+    stats->merge_gap = _MERGE_GAP;
+    stats->compared = ctx->diff_compared;
+    stats->changed = ctx->diff_changed;
+    stats->sent = ctx->diff_sent;
+    stats->windows = ctx->diff_windows;
+    stats->bits = ctx->refresh_bits;
+    return true;
+}
+
+
+bool ICACHE_FLASH_ATTR oled_set_display_list(uint8_t id, bool enable, uint16_t size)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    uint8_t *buf;
+
+    if (ctx == NULL)
+        return false;
+
+    if (!enable)
+    {
+        if (ctx->list == NULL)
+            return true;
+        // Bring the drawing back into a display buffer
+        if (ctx->home)
+        {
+            buf = ctx->home;
+            memset(buf, 0, _WIDTH(ctx) * _HEIGHT(ctx) / 8);
+        }
+        else
+        {
+            buf = zalloc(_WIDTH(ctx) * _HEIGHT(ctx) / 8);
+            if (buf == NULL)
+            {
+                dmsg_err_puts("Alloc OLED buffer failed.");
+                return false;
+            }
+        }
+        ctx->buffer = buf;
+        _replay(ctx);
+        free(ctx->list);
+        ctx->list = NULL;
+        return true;
+    }
+    if (ctx->list)
+        return true;
+    if (ctx->frame || ctx->own || ctx->console)
+    {
+        dmsg_err_puts("OLED display list mode not available in console mode, with sprites, canvas or attached buffer.");
+        return false;
+    }
+    if (_page_lock == NULL)
+    {
+        vSemaphoreCreateBinary(_page_lock);
+        if (_page_lock == NULL)
+        {
+            dmsg_err_puts("Create OLED page lock failed.");
+            return false;
+        }
+    }
+    ctx->list = zalloc(size);
+    if (ctx->list == NULL)
+    {
+        dmsg_err_puts("Alloc OLED display list failed.");
+        return false;
+    }
+    ctx->list_size = size;
+    oled_set_double_buffer(id, false, NULL, NULL);
+    oled_set_diff_refresh(id, false);
+    _free_buffer(ctx, ctx->buffer);
+    ctx->buffer = NULL;
+    oled_clear(id);
+    return true;
+}
+
+
+uint16_t ICACHE_FLASH_ATTR oled_get_display_list_len(uint8_t id)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    if ((ctx == NULL) || (ctx->list == NULL))
+       return 0;
+
+    return ctx->list_len;
+}
+
+
+bool ICACHE_FLASH_ATTR oled_push_viewport(uint8_t id, oled_coord_t x, oled_coord_t y, oled_coord_t w, oled_coord_t h)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    oled_view *v;
+
+    if (ctx == NULL)
+        return false;
+    if (ctx->view_depth >= OLED_VIEWPORT_DEPTH)
+    {
+        dmsg_err_puts("OLED viewport stack full.");
+        return false;
+    }
+    ctx->views[ctx->view_depth++] = ctx->view;
+    // New viewport is the part of the rectangle inside the current clip rectangle
+    v = &ctx->view;
+    v->x += x;
+    v->y += y;
+    v->left = (v->x > v->clip_left) ? v->x : v->clip_left;
+    v->top = (v->y > v->clip_top) ? v->y : v->clip_top;
+    v->right = (v->x + w - 1 < v->clip_right) ? v->x + w - 1 : v->clip_right;
+    v->bottom = (v->y + h - 1 < v->clip_bottom) ? v->y + h - 1 : v->clip_bottom;
+    v->clip_left = v->left;
+    v->clip_top = v->top;
+    v->clip_right = v->right;
+    v->clip_bottom = v->bottom;
+    _record_view(ctx);
+    return true;
+}
+
+
+void ICACHE_FLASH_ATTR oled_pop_viewport(uint8_t id)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if ((ctx == NULL) || (ctx->view_depth == 0))
+        return;
+    ctx->view = ctx->views[--ctx->view_depth];
+    _record_view(ctx);
+}
+
+
+void ICACHE_FLASH_ATTR oled_set_clip(uint8_t id, oled_coord_t x, oled_coord_t y, oled_coord_t w, oled_coord_t h)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    oled_view *v;
+
+    if (ctx == NULL)
+        return;
+    v = &ctx->view;
+    v->clip_left = (v->x + x > v->left) ? v->x + x : v->left;
+    v->clip_top = (v->y + y > v->top) ? v->y + y : v->top;
+    v->clip_right = (v->x + x + w - 1 < v->right) ? v->x + x + w - 1 : v->right;
+    v->clip_bottom = (v->y + y + h - 1 < v->bottom) ? v->y + y + h - 1 : v->bottom;
+    _record_view(ctx);
+}
+
+
+void ICACHE_FLASH_ATTR oled_reset_clip(uint8_t id)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if (ctx == NULL)
+        return;
+    ctx->view.clip_left = ctx->view.left;
+    ctx->view.clip_top = ctx->view.top;
+    ctx->view.clip_right = ctx->view.right;
+    ctx->view.clip_bottom = ctx->view.bottom;
+    _record_view(ctx);
+}
+
+
+/**
+ * @brief   Paint pixel, in panel coordinates
+ */
+LOCAL void ICACHE_FLASH_ATTR _pixel(oled_i2c_ctx *ctx, int16_t x, int16_t y, oled_color_t color)
+{
+    uint32_t index;
+
+    if ((x < ctx->view.clip_left) || (x > ctx->view.clip_right) || (y < ctx->view.clip_top) || (y > ctx->view.clip_bottom)
+        || (y / 8 < ctx->band_first) || (y / 8 > ctx->band_last))
+        return;
+
+    index = x + (y / 8 - ctx->band_first) * _STRIDE(ctx);
+    switch (color)
+    {
+    case OLED_COLOR_WHITE:
+        ctx->buffer[index] |= (1 << (y & 7));
+        break;
+    case OLED_COLOR_BLACK:
+        ctx->buffer[index] &= ~(1 << (y & 7));
+        break;
+    case OLED_COLOR_INVERT:
+        ctx->buffer[index] ^= (1 << (y & 7));
+        break;
+    }
+    // Dirty spans are kept for the panel
+    x -= _WIN_X(ctx);
+    y -= _WIN_Y(ctx);
+    if ((x < 0) || (x >= _WIDTH(ctx)) || (y < 0) || (y >= _HEIGHT(ctx)))
+        return;
+    index = y / 8;
+    if (ctx->dirty_left[index] > x) ctx->dirty_left[index] = x;
+    if (ctx->dirty_right[index] < x) ctx->dirty_right[index] = x;
+}
+
+
+void ICACHE_FLASH_ATTR oled_draw_pixel(uint8_t id, oled_coord_t x, oled_coord_t y, oled_color_t color)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if (ctx == NULL)
+        return;
+
+    if (_RECORDING(ctx))
+    {
+        uint8_t op[] = { _OP_PIXEL, _C16(x), _C16(y), color };
+        _record(ctx, op, sizeof(op), x, y, x, y);
+        return;
+    }
+    _pixel(ctx, x + ctx->view.x, y + ctx->view.y, color);
+}
+
+
+/**
+ * @brief   Paint horizontal line, in panel coordinates
+ */
+LOCAL void ICACHE_FLASH_ATTR _hline(oled_i2c_ctx *ctx, int16_t x, int16_t y, int16_t w, oled_color_t color)
+{
+    int16_t left = x, top = y, right = x + w - 1, bottom = y;
+    uint32_t index;
+    uint16_t t;
+    uint8_t mask;
+
+    if ((w <= 0) || !_clip_rect(ctx, &left, &top, &right, &bottom))
+        return;
+
+    t = right - left + 1;
+    index = left + (y / 8 - ctx->band_first) * _STRIDE(ctx);
+    mask = 1 << (y & 7);
+    switch (color)
+    {
+    case OLED_COLOR_WHITE:
+        while (t--)
+        {
+            ctx->buffer[index] |= mask;
+            ++index;
+        }
+        break;
+    case OLED_COLOR_BLACK:
+        mask = ~mask;
+        while (t--)
+        {
+            ctx->buffer[index] &= mask;
+            ++index;
+        }
+        break;
+    case OLED_COLOR_INVERT:
+        while (t--)
+        {
+            ctx->buffer[index] ^= mask;
+            ++index;
+        }
+        break;
+    }
+    _mark_drawn(ctx, left, y, right, y);
+}
+
+
+void ICACHE_FLASH_ATTR oled_draw_hline(uint8_t id, oled_coord_t x, oled_coord_t y, oled_coord_t w, oled_color_t color)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if (ctx == NULL)
+        return;
+    if (_RECORDING(ctx))
+    {
+        uint8_t op[] = { _OP_HLINE, _C16(x), _C16(y), _C16(w), color };
+        _record(ctx, op, sizeof(op), x, y, x + w - 1, y);
+        return;
+    }
+    _hline(ctx, x + ctx->view.x, y + ctx->view.y, w, color);
+}
+
+
+/**
+ * @brief   Paint vertical line, in panel coordinates
+ */
+LOCAL void ICACHE_FLASH_ATTR _vline(oled_i2c_ctx *ctx, int16_t x, int16_t y, int16_t h, oled_color_t color)
+{
+    int16_t left = x, top = y, right = x, bottom = y + h - 1;
+    uint32_t index;
+    uint16_t t;
+    uint8_t mask, mod;
+
+    if ((h <= 0) || !_clip_rect(ctx, &left, &top, &right, &bottom))
+        return;
+
+    t = bottom - top + 1;
+    index = x + (top / 8 - ctx->band_first) * _STRIDE(ctx);
+    mod = top & 7;
+    if (mod) // partial line that does not fit into byte at top
+    {
+        // Magic from Adafruit
+        mod = 8 - mod;
+        static const uint8_t premask[8] = { 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE };
+        mask = premask[mod];
+        if (t < mod)
+            mask &= (0xFF >> (mod - t));
+        switch (color)
+        {
+        case OLED_COLOR_WHITE:
+            ctx->buffer[index] |= mask;
+            break;
+        case OLED_COLOR_BLACK:
+            ctx->buffer[index] &= ~mask;
+            break;
+        case OLED_COLOR_INVERT:
+            ctx->buffer[index] ^= mask;
+            break;
+        }
+        if (t < mod)
+            goto draw_vline_finish;
+        t -= mod;
+        index += _STRIDE(ctx);
+    }
+    if (t >= 8) // byte aligned line at middle
+    {
+        switch (color)
+        {
+        case OLED_COLOR_WHITE:
+            do
+           {
+               ctx->buffer[index] = 0xff;
+               index += _STRIDE(ctx);
+               t -= 8;
+           } while (t >= 8);
+            break;
+        case OLED_COLOR_BLACK:
+            do
+            {
+               ctx->buffer[index] = 0x00;
+               index += _STRIDE(ctx);
+               t -= 8;
+            } while (t >= 8);
+            break;
+        case OLED_COLOR_INVERT:
+            do
+            {
+                ctx->buffer[index] = ~ctx->buffer[index];
+                index += _STRIDE(ctx);
+                t -= 8;
+            } while (t >= 8);
+            break;
+        }
+    }
+    if (t) // // partial line at bottom
+    {
+        mod = t & 7;
+        static const uint8_t postmask[8] = {0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F };
+        mask = postmask[mod];
+        switch (color)
+        {
+        case OLED_COLOR_WHITE:
+            ctx->buffer[index] |= mask;
+            break;
+        case OLED_COLOR_BLACK:
+            ctx->buffer[index] &= ~mask;
+            break;
+        case OLED_COLOR_INVERT:
+            ctx->buffer[index] ^= mask;
+            break;
+        }
+    }
+draw_vline_finish:
+    _mark_drawn(ctx, x, top, x, bottom);
+}
+
+
+void ICACHE_FLASH_ATTR oled_draw_vline(uint8_t id, oled_coord_t x, oled_coord_t y, oled_coord_t h, oled_color_t color)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if (ctx == NULL)
+        return;
+    if (_RECORDING(ctx))
+    {
+        uint8_t op[] = { _OP_VLINE, _C16(x), _C16(y), _C16(h), color };
+        _record(ctx, op, sizeof(op), x, y, x, y + h - 1);
+        return;
+    }
+    _vline(ctx, x + ctx->view.x, y + ctx->view.y, h, color);
+}
+
+
+//! @brief Cohen-Sutherland outcodes
+#define _CLIP_LEFT      0x01
+#define _CLIP_RIGHT     0x02
+#define _CLIP_TOP       0x04
+#define _CLIP_BOTTOM    0x08
+
+LOCAL uint8_t ICACHE_FLASH_ATTR _outcode(oled_i2c_ctx *ctx, int16_t x, int16_t y)
+{
+    uint8_t code = 0;
+
+    if (x < ctx->view.clip_left)
+        code |= _CLIP_LEFT;
+    else if (x > ctx->view.clip_right)
+        code |= _CLIP_RIGHT;
+    if (y < ctx->view.clip_top)
+        code |= _CLIP_TOP;
+    else if (y > ctx->view.clip_bottom)
+        code |= _CLIP_BOTTOM;
+    return code;
+}
+
+
+//! @brief a / b rounded to the nearest integer, halves away from zero
+LOCAL int32_t ICACHE_FLASH_ATTR _div_round(int32_t a, int32_t b)
+{
+    return ((a < 0) != (b < 0)) ? (a - b / 2) / b : (a + b / 2) / b;
+}
+
+
+/**
+ * @brief   Clip line to clip rectangle (Cohen-Sutherland). Edge crossings are taken from the
+ *          original line and rounded to the nearest pixel, so a clipped end is on the line.
+ * @return  false if the line is entirely outside the clip rectangle
+ */
+LOCAL bool ICACHE_FLASH_ATTR _clip_line(oled_i2c_ctx *ctx, int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1)
+{
+    uint8_t c0 = _outcode(ctx, *x0, *y0);
+    uint8_t c1 = _outcode(ctx, *x1, *y1);
+    uint8_t c;
+    int16_t x, y, ax = *x0, ay = *y0;
+    int32_t dx = *x1 - *x0, dy = *y1 - *y0;
+
+    for (;;)
+    {
+        if (!(c0 | c1))
+            return true;    // Both ends inside
+        if (c0 & c1)
+            return false;   // Both ends on the outside of the same edge
+        // Move the end outside to the edge it is beyond
+        c = c0 ? c0 : c1;
+        if (c & _CLIP_TOP)
+        {
+            y = ctx->view.clip_top;
+            x = ax + _div_round(dx * (y - ay), dy);
+        }
+        else if (c & _CLIP_BOTTOM)
+        {
+            y = ctx->view.clip_bottom;
+            x = ax + _div_round(dx * (y - ay), dy);
+        }
+        else if (c & _CLIP_LEFT)
+        {
+            x = ctx->view.clip_left;
+            y = ay + _div_round(dy * (x - ax), dx);
+        }
+        else
+        {
+            x = ctx->view.clip_right;
+            y = ay + _div_round(dy * (x - ax), dx);
+        }
+        if (c == c0)
+        {
+            *x0 = x;
+            *y0 = y;
+            c0 = _outcode(ctx, x, y);
+        }
+        else
+        {
+            *x1 = x;
+            *y1 = y;
+            c1 = _outcode(ctx, x, y);
+        }
+    }
+}
+
+
+/**
+ * @brief   Paint rows top to bottom of column x, one byte mask per page
+ */
+LOCAL void ICACHE_FLASH_ATTR _vrun(oled_i2c_ctx *ctx, int16_t x, int16_t top, int16_t bottom, oled_color_t color)
+{
+    uint8_t *d;
+    uint8_t mask;
+    int16_t page;
+
+    if (top < ctx->band_first * 8) top = ctx->band_first * 8;
+    if (bottom >= (ctx->band_last + 1) * 8) bottom = (ctx->band_last + 1) * 8 - 1;
+    for (page = top / 8; page <= bottom / 8; ++page)
+    {
+        mask = _page_rows(page, top, bottom);
+        d = ctx->buffer + (page - ctx->band_first) * _STRIDE(ctx) + x;
+        switch (color)
+        {
+        case OLED_COLOR_WHITE:
+            *d |= mask;
+            break;
+        case OLED_COLOR_BLACK:
+            *d &= ~mask;
+            break;
+        case OLED_COLOR_INVERT:
+            *d ^= mask;
+            break;
+        }
+    }
+}
+
+
+/**
+ * @brief   Paint columns of row y from x to x + n - 1, or to x - n + 1 if step is -1
+ */
+LOCAL void ICACHE_FLASH_ATTR _hrun(oled_i2c_ctx *ctx, int16_t x, int16_t y, int16_t n, int8_t step, oled_color_t color)
+{
+    uint8_t *d;
+    uint8_t mask = 1 << (y & 7);
+
+    if ((y / 8 < ctx->band_first) || (y / 8 > ctx->band_last))
+        return;
+    d = ctx->buffer + (y / 8 - ctx->band_first) * _STRIDE(ctx) + x;
+    switch (color)
+    {
+    case OLED_COLOR_WHITE:
+        for (; n; --n, d += step)
+            *d |= mask;
+        break;
+    case OLED_COLOR_BLACK:
+        for (mask = ~mask; n; --n, d += step)
+            *d &= mask;
+        break;
+    case OLED_COLOR_INVERT:
+        for (; n; --n, d += step)
+            *d ^= mask;
+        break;
+    }
+}
+
+
+void ICACHE_FLASH_ATTR oled_draw_line(uint8_t id, oled_coord_t x0, oled_coord_t y0, oled_coord_t x1, oled_coord_t y1, oled_color_t color)
+{
+    // Run-slice line algorithm, see Michael Abrash's Graphics Programming Black Book, chapter 36
+    oled_i2c_ctx *ctx = _CTX(id);
+    int16_t ax, ay, bx, by, t;
+    int16_t dx, dy, whole, adj_up, adj_down, err, first, last, run, i;
+    int16_t left, right;
+    int8_t step;
+
+    if (ctx == NULL)
+        return;
+    if (_RECORDING(ctx))
+    {
+        uint8_t op[] = { _OP_LINE, _C16(x0), _C16(y0), _C16(x1), _C16(y1), color };
+        _record(ctx, op, sizeof(op), (x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1, (x0 < x1) ? x1 : x0, (y0 < y1) ? y1 : y0);
+        return;
+    }
+    ax = x0 + ctx->view.x;
+    ay = y0 + ctx->view.y;
+    bx = x1 + ctx->view.x;
+    by = y1 + ctx->view.y;
+    if (!_clip_line(ctx, &ax, &ay, &bx, &by))
+        return;
+    // Draw top to bottom
+    if (ay > by)
+    {
+        t = ax; ax = bx; bx = t;
+        t = ay; ay = by; by = t;
+    }
+    if (ay == by)
+    {
+        _hline(ctx, (ax < bx) ? ax : bx, ay, ((ax < bx) ? bx - ax : ax - bx) + 1, color);
+        return;
+    }
+    if (ax == bx)
+    {
+        _vline(ctx, ax, ay, by - ay + 1, color);
+        return;
+    }
+    if (color == OLED_COLOR_TRANSPARENT)
+        return;
+
+    left = (ax < bx) ? ax : bx;
+    right = (ax < bx) ? bx : ax;
+    dx = bx - ax;
+    step = 1;
+    if (dx < 0)
+    {
+        dx = -dx;
+        step = -1;
+    }
+    dy = by - ay;
+    if (dx >= dy)
+    {
+        // X major, one horizontal run per row
+        whole = dx / dy;
+        adj_up = (dx % dy) * 2;
+        adj_down = dy * 2;
+        err = (dx % dy) - dy * 2;
+        first = last = whole / 2 + 1;
+        if ((adj_up == 0) && !(whole & 1))
+            --first;
+        if (whole & 1)
+            err += dy;
+        _hrun(ctx, ax, ay, first, step, color);
+        ax += first * step;
+        for (i = 1; i < dy; ++i)
+        {
+            run = whole;
+            err += adj_up;
+            if (err > 0)
+            {
+                ++run;
+                err -= adj_down;
+            }
+            _hrun(ctx, ax, ay + i, run, step, color);
+            ax += run * step;
+        }
+        _hrun(ctx, ax, by, last, step, color);
+    }
+    else
+    {
+        // Y major, one vertical run per column
+        whole = dy / dx;
+        adj_up = (dy % dx) * 2;
+        adj_down = dx * 2;
+        err = (dy % dx) - dx * 2;
+        first = last = whole / 2 + 1;
+        if ((adj_up == 0) && !(whole & 1))
+            --first;
+        if (whole & 1)
+            err += dx;
+        _vrun(ctx, ax, ay, ay + first - 1, color);
+        ay += first;
+        for (i = 1; i < dx; ++i)
+        {
+            run = whole;
+            err += adj_up;
+            if (err > 0)
+            {
+                ++run;
+                err -= adj_down;
+            }
+            ax += step;
+            _vrun(ctx, ax, ay, ay + run - 1, color);
+            ay += run;
+        }
+        _vrun(ctx, ax + step, ay, ay + last - 1, color);
+    }
+    _mark_drawn(ctx, left, by - dy, right, by);
+}
+
+
+void ICACHE_FLASH_ATTR oled_draw_rectangle(uint8_t id, oled_coord_t x, oled_coord_t y, oled_coord_t w, oled_coord_t h, oled_color_t color)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    int16_t x0, y0;
+
+    if (ctx == NULL)
+        return;
+    if ((w == 0) || (h == 0))
+        return;
+    if (_RECORDING(ctx))
+    {
+        uint8_t op[] = { _OP_RECT, _C16(x), _C16(y), _C16(w), _C16(h), color };
+        _record(ctx, op, sizeof(op), x, y, x + w - 1, y + h - 1);
+        return;
+    }
+    x0 = x + ctx->view.x;
+    y0 = y + ctx->view.y;
+    _hline(ctx, x0, y0, w, color);
+    _hline(ctx, x0, y0 + h - 1, w, color);
+    _vline(ctx, x0, y0, h, color);
+    _vline(ctx, x0 + w - 1, y0, h, color);
+}
+
+
+/**
+ * @brief   Paint the bits in mask of n consecutive display bytes, a 32-bit word at a time where aligned
+ */
+LOCAL void ICACHE_FLASH_ATTR _fill_span(uint8_t *d, uint16_t n, uint8_t mask, oled_color_t color)
+{
+    uint32_t m = mask * 0x01010101UL;
+    uint32_t set = (color == OLED_COLOR_WHITE) ? m : 0;
+    uint32_t clr = (color == OLED_COLOR_BLACK) ? m : 0;
+    uint32_t flip = (color == OLED_COLOR_INVERT) ? m : 0;
+    uint32_t *w;
+
+    if ((mask == 0xff) && (color != OLED_COLOR_INVERT))
+    {
+        memset(d, (uint8_t)set, n);
+        return;
+    }
+    while (n && ((size_t)d & 3))
+    {
+        *d = ((*d & ~clr) | set) ^ flip;
+        ++d;
+        --n;
+    }
+    for (w = (uint32_t *)d; n >= 4; n -= 4, ++w)
+        *w = ((*w & ~clr) | set) ^ flip;
+    for (d = (uint8_t *)w; n; --n, ++d)
+        *d = ((*d & ~clr) | set) ^ flip;
+}
+
+
+void ICACHE_FLASH_ATTR oled_fill_rectangle(uint8_t id, oled_coord_t x, oled_coord_t y, oled_coord_t w, oled_coord_t h, oled_color_t color)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    int16_t left, right, top, bottom;
+    uint8_t page;
+
+    if (ctx == NULL)
+        return;
+    if (_RECORDING(ctx))
+    {
+        uint8_t op[] = { _OP_FILL_RECT, _C16(x), _C16(y), _C16(w), _C16(h), color };
+        _record(ctx, op, sizeof(op), x, y, x + w - 1, y + h - 1);
+        return;
+    }
+    if ((w == 0) || (h == 0) || (color == OLED_COLOR_TRANSPARENT))
+        return;
+
+    left = x + ctx->view.x;
+    top = y + ctx->view.y;
+    right = left + w - 1;
+    bottom = top + h - 1;
+    if (!_clip_rect(ctx, &left, &top, &right, &bottom))
+        return;
+
+    // Partial pages at top and bottom are masked, pages in between are filled whole
+    for (page = top / 8; page <= bottom / 8; ++page)
+        _fill_span(ctx->buffer + (page - ctx->band_first) * _STRIDE(ctx) + left, right - left + 1, _page_rows(page, top, bottom), color);
+    _mark_drawn(ctx, left, top, right, bottom);
+}
+
+
+void ICACHE_FLASH_ATTR oled_draw_circle(uint8_t id, oled_coord_t x0, oled_coord_t y0, oled_coord_t r, oled_color_t color)
+{
+    // Refer to http://en.wikipedia.org/wiki/Midpoint_circle_algorithm for the algorithm
+
+    oled_i2c_ctx *ctx = _CTX(id);
+    int16_t x = r;
+    int16_t y = 1;
+    int16_t radius_err = 1 - x;
+    int16_t cx, cy;
+
+    if (ctx == NULL)
+        return;
+
+    if (r == 0)
+        return;
+
+    if (_RECORDING(ctx))
+    {
+        uint8_t op[] = { _OP_CIRCLE, _C16(x0), _C16(y0), _C16(r), color };
+        _record(ctx, op, sizeof(op), x0 - r, y0 - r, x0 + r, y0 + r);
+        return;
+    }
+    cx = x0 + ctx->view.x;
+    cy = y0 + ctx->view.y;
+    if ((cx + r < ctx->view.clip_left) || (cx - r > ctx->view.clip_right)
+        || (cy + r < ctx->view.clip_top) || (cy - r > ctx->view.clip_bottom))
+        return;
+
+    _pixel(ctx, cx - r, cy,     color);
+    _pixel(ctx, cx + r, cy,     color);
+    _pixel(ctx, cx,     cy - r, color);
+    _pixel(ctx, cx,     cy + r, color);
+
+    while (x >= y)
+    {
+        _pixel(ctx, cx + x, cy + y, color);
+        _pixel(ctx, cx - x, cy + y, color);
+        _pixel(ctx, cx + x, cy - y, color);
+        _pixel(ctx, cx - x, cy - y, color);
+        if (x != y)
         {
-            ctx->buffer[index] ^= mask;
-            ++index;
+            /* Otherwise the 4 drawings below are the same as above, causing
+             * problem when color is INVERT
+             */
+            _pixel(ctx, cx + y, cy + x, color);
+            _pixel(ctx, cx - y, cy + x, color);
+            _pixel(ctx, cx + y, cy - x, color);
+            _pixel(ctx, cx - y, cy - x, color);
+        }
+        ++y;
+        if (radius_err < 0)
+        {
+            radius_err += 2 * y + 1;
+        }
+        else
+        {
+            --x;
+            radius_err += 2 * (y - x + 1);
+        }
+
+    }
+}
+
+
+void ICACHE_FLASH_ATTR oled_fill_circle(uint8_t id, oled_coord_t x0, oled_coord_t y0, oled_coord_t r, oled_color_t color)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    int16_t x = 1;
+    int16_t y = r;
+    int16_t radius_err = 1 - y;
+    int16_t cx, cy;
+    int16_t x1;
+
+    if (ctx == NULL)
+        return;
+
+    if (r == 0)
+        return;
+
+    if (_RECORDING(ctx))
+    {
+        uint8_t op[] = { _OP_FILL_CIRCLE, _C16(x0), _C16(y0), _C16(r), color };
+        _record(ctx, op, sizeof(op), x0 - r, y0 - r, x0 + r, y0 + r);
+        return;
+    }
+    cx = x0 + ctx->view.x;
+    cy = y0 + ctx->view.y;
+    if ((cx + r < ctx->view.clip_left) || (cx - r > ctx->view.clip_right)
+        || (cy + r < ctx->view.clip_top) || (cy - r > ctx->view.clip_bottom))
+        return;
+
+    _vline(ctx, cx, cy - r, 2 * r + 1, color); // Center vertical line
+    while (y >= x)
+    {
+        _vline(ctx, cx - x, cy - y, 2 * y + 1, color);
+        _vline(ctx, cx + x, cy - y, 2 * y + 1, color);
+        if (color != OLED_COLOR_INVERT)
+        {
+            _vline(ctx, cx - y, cy - x, 2 * x + 1, color);
+            _vline(ctx, cx + y, cy - x, 2 * x + 1, color);
+        }
+        ++x;
+        if (radius_err < 0)
+        {
+            radius_err += 2 * x + 1;
+        }
+        else
+        {
+            --y;
+            radius_err += 2 * (x - y + 1);
+        }
+    }
+
+    if (color == OLED_COLOR_INVERT)
+    {
+        x1 = x; // Save where we stopped
+
+        y = 1;
+        x = r;
+        radius_err = 1 - x;
+        _hline(ctx, cx + x1, cy, r - x1 + 1, color);
+        _hline(ctx, cx - r, cy, r - x1 + 1, color);
+        while (x >= y)
+        {
+            _hline(ctx, cx + x1, cy - y, x - x1 + 1, color);
+            _hline(ctx, cx + x1, cy + y, x - x1 + 1, color);
+            _hline(ctx, cx - x,  cy - y, x - x1 + 1, color);
+            _hline(ctx, cx - x,  cy + y, x - x1 + 1, color);
+            ++y;
+            if (radius_err < 0)
+            {
+                radius_err += 2 * y + 1;
+            }
+            else
+            {
+                --x;
+                radius_err += 2 * (y - x + 1);
+            }
+        }
+    }
+}
+
+
+void ICACHE_FLASH_ATTR oled_select_font(uint8_t id, uint8_t idx)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if (ctx == NULL)
+            return;
+    if (idx >= OLED_NUM_FONTS)
+        return;
+    if (_RECORDING(ctx))
+    {
+        uint8_t op[] = { _OP_FONT, idx };
+        _record(ctx, op, sizeof(op), 0, 0, -1, -1);
+    }
+    ctx->font = oled_fonts[idx];
+}
+
+
+/**
+ * @brief   Gather 8 rows of one column of a row format bitmap into a page-aligned byte. In row format
+ *          each row is padded to whole bytes with the leftmost pixel in the MSB, rows top to bottom.
+ * @param   src     Bitmap
+ * @param   w       Bitmap width
+ * @param   h       Bitmap height
+ * @param   sp      Page of bitmap (rows sp * 8 to sp * 8 + 7)
+ * @param   col     Column of bitmap
+ */
+LOCAL uint8_t ICACHE_FLASH_ATTR _row_byte(const uint8_t *src, uint8_t w, uint8_t h, uint8_t sp, uint8_t col)
+{
+    uint8_t stride = (w + 7) / 8;
+    uint8_t bit = 0x80 >> (col & 7);
+    uint8_t d = 0, k, row;
+
+    src += sp * 8 * stride + col / 8;
+    for (k = 0, row = sp * 8; (k < 8) && (row < h); ++k, ++row, src += stride)
+    {
+        if (*src & bit)
+            d |= 1 << k;
+    }
+    return d;
+}
+
+
+// return character width
+//! @brief Paint foreground bits f and background bits b into display byte d, with the color masks
+//!        set up by _blit()
+#define _PAINT(d, f, b) ((d) = ((((d) & ~(((f) & fk) | ((b) & bk))) | ((f) & fw) | ((b) & bw)) ^ ((f) & fi)))
+
+/**
+ * @brief   Paint a page-aligned bitmap into display buffer, in panel coordinates. The bitmap is laid out like display RAM:
+ *          each byte holds 8 rows of one column (LSB on top), columns run left to right, and each
+ *          group of 8 rows follows the one above it.
+ * @param   ctx         Panel context
+ * @param   x           Left of bitmap on panel
+ * @param   y           Top of bitmap on panel
+ * @param   src         Bitmap
+ * @param   alpha       Bitmap of the pixels to paint, same layout as src. NULL paints all pixels
+ * @param   w           Bitmap width
+ * @param   h           Bitmap height
+ * @param   rows        src and alpha are in row format (see _row_byte()) rather than page-aligned
+ * @param   foreground  Color of set bits
+ * @param   background  Color of clear bits. Inverting background is not supported and leaves it alone
+ */
+LOCAL void ICACHE_FLASH_ATTR _blit(oled_i2c_ctx *ctx, int16_t x, int16_t y, const uint8_t *src, const uint8_t *alpha,
+                                   uint8_t w, uint8_t h, bool rows, oled_color_t foreground, oled_color_t background)
+{
+    uint8_t fw = (foreground == OLED_COLOR_WHITE) ? 0xff : 0x00;   // Set
+    uint8_t fk = (foreground == OLED_COLOR_BLACK) ? 0xff : 0x00;   // Clear
+    uint8_t fi = (foreground == OLED_COLOR_INVERT) ? 0xff : 0x00;  // Flip
+    uint8_t bw = (background == OLED_COLOR_WHITE) ? 0xff : 0x00;
+    uint8_t bk = (background == OLED_COLOR_BLACK) ? 0xff : 0x00;
+    int16_t left, right, top, bottom, col, page, row;
+    uint8_t shift, pages, sp, f, b, a, mask;
+    uint8_t *lo, *hi;
+    uint16_t fs, bs;
+
+    left = x;
+    top = y;
+    right = x + w - 1;
+    bottom = y + h - 1;
+    if (!_clip_rect(ctx, &left, &top, &right, &bottom))
+        return;
+
+    shift = y & 7;
+    pages = (h + 7) / 8;
+    for (sp = 0; sp < pages; ++sp)
+    {
+        // Rows of this source page inside the clip rectangle
+        row = y + sp * 8;
+        if (row + 7 < top)
+            continue;
+        if (row > bottom)
+            break;
+        mask = 0xff;
+        if (row < top)
+            mask &= 0xff << (top - row);
+        if (row + 7 > bottom)
+            mask &= 0xff >> (row + 7 - bottom);
+        page = (y >> 3) + sp;   // Display page receiving the low part
+        lo = (uint8_t)(mask << shift) ? ctx->buffer + (page - ctx->band_first) * _STRIDE(ctx) : NULL;
+        hi = ((mask << shift) >> 8) ? ctx->buffer + (page + 1 - ctx->band_first) * _STRIDE(ctx) : NULL;
+        for (col = left; col <= right; ++col)
+        {
+            if (rows)
+            {
+                f = _row_byte(src, w, h, sp, col - x);
+                a = alpha ? _row_byte(alpha, w, h, sp, col - x) & mask : mask;
+            }
+            else
+            {
+                f = src[sp * w + col - x];
+                a = alpha ? alpha[sp * w + col - x] & mask : mask;
+            }
+            b = ~f & a;
+            f &= a;
+            fs = f << shift;
+            bs = b << shift;
+            if (lo)
+                _PAINT(lo[col], (uint8_t)fs, (uint8_t)bs);
+            if (hi)
+                _PAINT(hi[col], (uint8_t)(fs >> 8), (uint8_t)(bs >> 8));
         }
+    }
+    _mark_drawn(ctx, left, top, right, bottom);
+}
+
+
+void ICACHE_FLASH_ATTR oled_draw_bitmap(uint8_t id, oled_coord_t x, oled_coord_t y, const uint8_t *bitmap, const uint8_t *mask,
+                                        uint8_t w, uint8_t h, oled_bitmap_format_t format, oled_rop_t rop)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    int16_t px, py;
+
+    if (ctx == NULL)
+        return;
+    if ((bitmap == NULL) || (w == 0) || (h == 0))
+        return;
+    if (_RECORDING(ctx))
+    {
+        // Bitmaps are not copied, only referenced
+        uint8_t op[9 + 2 * sizeof(const uint8_t *)] = { _OP_BITMAP, _C16(x), _C16(y), w, h, format, rop };
+        memcpy(op + 9, &bitmap, sizeof(bitmap));
+        memcpy(op + 9 + sizeof(bitmap), &mask, sizeof(mask));
+        _record(ctx, op, sizeof(op), x, y, x + w - 1, y + h - 1);
+        return;
+    }
+    px = x + ctx->view.x;
+    py = y + ctx->view.y;
+    switch (rop)
+    {
+    case OLED_ROP_COPY:
+        _blit(ctx, px, py, bitmap, NULL, w, h, format == OLED_BITMAP_ROW, OLED_COLOR_WHITE, OLED_COLOR_BLACK);
+        break;
+    case OLED_ROP_OR:
+        _blit(ctx, px, py, bitmap, NULL, w, h, format == OLED_BITMAP_ROW, OLED_COLOR_WHITE, OLED_COLOR_TRANSPARENT);
+        break;
+    case OLED_ROP_AND:
+        _blit(ctx, px, py, bitmap, NULL, w, h, format == OLED_BITMAP_ROW, OLED_COLOR_TRANSPARENT, OLED_COLOR_BLACK);
         break;
+    case OLED_ROP_XOR:
+        _blit(ctx, px, py, bitmap, NULL, w, h, format == OLED_BITMAP_ROW, OLED_COLOR_INVERT, OLED_COLOR_TRANSPARENT);
+        break;
+    case OLED_ROP_MASKED:
+        _blit(ctx, px, py, bitmap, mask, w, h, format == OLED_BITMAP_ROW, OLED_COLOR_WHITE, OLED_COLOR_BLACK);
+        break;
+    }
+}
+
+
+/*
+ * Frame. With sprites or a canvas, refresh does not send the display buffer but a frame composed
+ * from it, page by page for the pages refresh is about to send: the window of the canvas, with
+ * sprites drawn over it.
+ */
+
+/**
+ * @brief   Rebuild dirty pages of frame from display buffer and sprites
+ */
+LOCAL void ICACHE_FLASH_ATTR _compose(oled_i2c_ctx *ctx, bool force)
+{
+    uint8_t order[OLED_MAX_SPRITES];
+    uint8_t left[OLED_MAX_PAGES], right[OLED_MAX_PAGES];
+    uint8_t *canvas = ctx->buffer;
+    uint16_t canvas_width = ctx->canvas_width, canvas_height = ctx->canvas_height;
+    int16_t win_x = ctx->win_x, win_y = ctx->win_y;
+    oled_view view = ctx->view;
+    const uint8_t *lo, *hi;
+    oled_sprite *sp;
+    uint8_t shift = win_y & 7;
+    uint8_t n = 0, i, j, t, p, c;
+
+    // Visible sprites, lowest z first
+    for (i = 0; ctx->sprites && (i < OLED_MAX_SPRITES); ++i)
+    {
+        if (!ctx->sprites[i].bitmap || !ctx->sprites[i].visible)
+            continue;
+        for (j = n++; (j > 0) && (ctx->sprites[order[j - 1]].z > ctx->sprites[i].z); --j)
+            order[j] = order[j - 1];
+        order[j] = i;
+    }
+    // Sprites are placed on the panel, not in the viewport or canvas. Painting them must not widen
+    // the spans refresh sends.
+    memcpy(left, ctx->dirty_left, OLED_MAX_PAGES);
+    memcpy(right, ctx->dirty_right, OLED_MAX_PAGES);
+    ctx->canvas_width = _WIDTH(ctx);
+    ctx->canvas_height = _HEIGHT(ctx);
+    ctx->win_x = ctx->win_y = 0;
+    _view_reset(ctx, &ctx->view);
+    for (p = 0; p < _HEIGHT(ctx) / 8; ++p)
+    {
+        if (!force && (left[p] > right[p]))
+            continue;
+        // Window rows, shifted up by the rows it starts into the canvas page. The window is kept
+        // inside the canvas, so there is a page below whenever shift is not 0.
+        lo = canvas + (win_y / 8 + p) * canvas_width + win_x;
+        if (shift == 0)
+        {
+            memcpy(ctx->frame + p * _WIDTH(ctx), lo, _WIDTH(ctx));
+        }
+        else
+        {
+            hi = lo + canvas_width;
+            for (c = 0; c < _WIDTH(ctx); ++c)
+                ctx->frame[p * _WIDTH(ctx) + c] = (lo[c] >> shift) | (hi[c] << (8 - shift));
+        }
+        // Blit into this page of frame only
+        ctx->buffer = ctx->frame + p * _WIDTH(ctx);
+        ctx->band_first = ctx->band_last = p;
+        for (t = 0; t < n; ++t)
+        {
+            sp = ctx->sprites + order[t];
+            if ((sp->y + sp->h > p * 8) && (sp->y < p * 8 + 8))
+                _blit(ctx, sp->x, sp->y, sp->bitmap, sp->mask, sp->w, sp->h, false, OLED_COLOR_WHITE, OLED_COLOR_BLACK);
+        }
+    }
+    ctx->buffer = canvas;
+    ctx->canvas_width = canvas_width;
+    ctx->canvas_height = canvas_height;
+    ctx->win_x = win_x;
+    ctx->win_y = win_y;
+    ctx->band_first = 0;
+    ctx->band_last = canvas_height / 8 - 1;
+    ctx->view = view;
+    memcpy(ctx->dirty_left, left, OLED_MAX_PAGES);
+    memcpy(ctx->dirty_right, right, OLED_MAX_PAGES);
+}
+
+
+bool ICACHE_FLASH_ATTR oled_set_canvas(uint8_t id, uint16_t width, uint16_t height)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    uint8_t *buf;
+    uint16_t w, p;
+
+    if (ctx == NULL)
+        return false;
+    if (width < _WIDTH(ctx))
+        width = _WIDTH(ctx);
+    height = (height + 7) & ~7;
+    if (height < _HEIGHT(ctx))
+        height = _HEIGHT(ctx);
+    if ((width == ctx->canvas_width) && (height == ctx->canvas_height))
+        return true;
+#if (OLED_FIXED_WIDTH != 0)
+    dmsg_err_puts("OLED canvas not available with OLED_FIXED_WIDTH.");
+    return false;
+#endif
+    if (ctx->list || ctx->front || ctx->own || ctx->console)
+    {
+        dmsg_err_puts("OLED canvas not available in display list or console mode, with double buffering or attached buffer.");
+        return false;
+    }
+    if (ctx->home && (width == _WIDTH(ctx)) && (height == _HEIGHT(ctx)))
+        buf = ctx->home;   // Back to the panel's own buffer
+    else
+        buf = zalloc((uint32_t)width * height / 8);
+    if (buf == NULL)
+    {
+        dmsg_err_puts("Alloc OLED canvas failed.");
+        return false;
+    }
+    if (ctx->frame == NULL)
+    {
+        ctx->frame = zalloc(_WIDTH(ctx) * _HEIGHT(ctx) / 8);
+        if (ctx->frame == NULL)
+        {
+            dmsg_err_puts("Alloc OLED frame buffer failed.");
+            _free_buffer(ctx, buf);
+            return false;
+        }
+    }
+    // Keep the top left of the drawing
+    w = (width < ctx->canvas_width) ? width : ctx->canvas_width;
+    for (p = 0; (p < height / 8) && (p < ctx->canvas_height / 8); ++p)
+        memcpy(buf + p * width, ctx->buffer + p * ctx->canvas_width, w);
+    _free_buffer(ctx, ctx->buffer);
+    ctx->buffer = buf;
+    ctx->canvas_width = width;
+    ctx->canvas_height = height;
+    ctx->band_last = height / 8 - 1;
+    ctx->win_x = ctx->win_y = 0;
+    ctx->view_depth = 0;
+    _view_reset(ctx, &ctx->view);
+    if (!_CANVAS(ctx) && (ctx->sprites == NULL))
+    {
+        free(ctx->frame);
+        ctx->frame = NULL;
+    }
+    _mark_dirty(ctx, 0, 0, _WIDTH(ctx) - 1, _HEIGHT(ctx) - 1);
+    return true;
+}
+
+
+void ICACHE_FLASH_ATTR oled_set_window(uint8_t id, oled_coord_t x, oled_coord_t y)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if (ctx == NULL)
+        return;
+    if (x > ctx->canvas_width - _WIDTH(ctx)) x = ctx->canvas_width - _WIDTH(ctx);
+    if (x < 0) x = 0;
+    if (y > ctx->canvas_height - _HEIGHT(ctx)) y = ctx->canvas_height - _HEIGHT(ctx);
+    if (y < 0) y = 0;
+    if ((x == ctx->win_x) && (y == ctx->win_y))
+        return;
+    ctx->win_x = x;
+    ctx->win_y = y;
+    // Nothing is redrawn, the next refresh composes the new window
+    _mark_dirty(ctx, 0, 0, _WIDTH(ctx) - 1, _HEIGHT(ctx) - 1);
+}
+
+
+bool ICACHE_FLASH_ATTR oled_attach_buffer(uint8_t id, uint8_t *buffer)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if ((ctx == NULL) || (buffer == NULL))
+        return false;
+    if (ctx->list || ctx->front || _CANVAS(ctx) || ctx->console)
+    {
+        dmsg_err_puts("OLED buffer attach not available in display list or console mode, with double buffering or canvas.");
+        return false;
+    }
+    if (ctx->own == NULL)
+        ctx->own = ctx->buffer;
+    ctx->buffer = buffer;
+    _mark_dirty(ctx, 0, 0, _WIDTH(ctx) - 1, _HEIGHT(ctx) - 1);
+    return true;
+}
+
+
+void ICACHE_FLASH_ATTR oled_detach_buffer(uint8_t id)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if ((ctx == NULL) || (ctx->own == NULL))
+        return;
+    // Drawing carries on from the last attached frame
+    memcpy(ctx->own, ctx->buffer, _WIDTH(ctx) * _HEIGHT(ctx) / 8);
+    ctx->buffer = ctx->own;
+    ctx->own = NULL;
+}
+
+
+void ICACHE_FLASH_ATTR oled_update_region(uint8_t id, oled_coord_t x, uint8_t page, oled_coord_t w, uint8_t pages,
+                                          const uint8_t *src, uint16_t stride)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    uint8_t p;
+
+    if ((ctx == NULL) || (ctx->buffer == NULL))
+        return;
+    if (x < 0)
+    {
+        if (src)
+            src -= x;
+        w += x;
+        x = 0;
+    }
+    if (x + w > ctx->canvas_width)
+        w = ctx->canvas_width - x;
+    if (page + pages > ctx->canvas_height / 8)
+        pages = (page < ctx->canvas_height / 8) ? ctx->canvas_height / 8 - page : 0;
+    if ((w <= 0) || (pages == 0))
+        return;
+    if (src)
+    {
+        for (p = 0; p < pages; ++p)
+            memcpy(ctx->buffer + (page + p) * _STRIDE(ctx) + x, src + p * stride, w);
     }
-    if (ctx->refresh_left > x) ctx->refresh_left = x;
-    if (ctx->refresh_right < x + w - 1) ctx->refresh_right = x + w - 1;
-    if (ctx->refresh_top > y) ctx->refresh_top = y;
-    if (ctx->refresh_bottom < y) ctx->refresh_bottom = y;
+    _mark_drawn(ctx, x, page * 8, x + w - 1, (page + pages) * 8 - 1);
+}
+
+
+//! @brief Mark area covered by a visible sprite dirty
+LOCAL void ICACHE_FLASH_ATTR _invalidate(oled_i2c_ctx *ctx, oled_sprite *sp)
+{
+    if (sp->visible)
+        _mark_region(ctx, sp->x, sp->y, sp->x + sp->w - 1, sp->y + sp->h - 1);
+}
+
+
+//! @brief Sprite by handle, NULL if not valid
+LOCAL oled_sprite * ICACHE_FLASH_ATTR _sprite(uint8_t id, int8_t sprite)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if ((ctx == NULL) || (ctx->sprites == NULL) || (sprite < 0) || (sprite >= OLED_MAX_SPRITES))
+        return NULL;
+    if (ctx->sprites[sprite].bitmap == NULL)
+        return NULL;
+    return ctx->sprites + sprite;
 }
 
 
-void ICACHE_FLASH_ATTR oled_draw_vline(uint8_t id, int8_t x, int8_t y, uint8_t h, oled_color_t color)
+bool ICACHE_FLASH_ATTR oled_set_sprites(uint8_t id, bool enable)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint16_t index;
-    uint8_t mask, mod, t;
+    oled_i2c_ctx *ctx = _CTX(id);
 
     if (ctx == NULL)
-        return;
-    // boundary check
-    if ((x >= ctx->width) || (x < 0) || (y >= ctx->height) || (y < 0))
-        return;
-    if (h == 0)
-        return;
-    if (y + h > ctx->height)
-        h = ctx->height - y;
+        return false;
 
-    t = h;
-    index = x + (y / 8) * ctx->width;
-    mod = y & 7;
-    if (mod) // partial line that does not fit into byte at top
+    if (!enable)
     {
-        // Magic from Adafruit
-        mod = 8 - mod;
-        static const uint8_t premask[8] = { 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE };
-        mask = premask[mod];
-        if (t < mod)
-            mask &= (0xFF >> (mod - t));
-        switch (color)
+        if (ctx->sprites == NULL)
+            return true;
+        free(ctx->sprites);
+        ctx->sprites = NULL;
+        if (!_CANVAS(ctx))
         {
-        case OLED_COLOR_WHITE:
-            ctx->buffer[index] |= mask;
-            break;
-        case OLED_COLOR_BLACK:
-            ctx->buffer[index] &= ~mask;
-            break;
-        case OLED_COLOR_INVERT:
-            ctx->buffer[index] ^= mask;
-            break;
+            free(ctx->frame);
+            ctx->frame = NULL;
         }
-        if (t < mod)
-            goto draw_vline_finish;
-        t -= mod;
-        index += ctx->width;
+        // Panel still shows the sprites
+        _mark_dirty(ctx, 0, 0, _WIDTH(ctx) - 1, _HEIGHT(ctx) - 1);
+        return true;
     }
-    if (t >= 8) // byte aligned line at middle
+    if (ctx->sprites)
+        return true;
+    if (ctx->list || ctx->front || ctx->console)
     {
-        switch (color)
-        {
-        case OLED_COLOR_WHITE:
-            do
-           {
-               ctx->buffer[index] = 0xff;
-               index += ctx->width;
-               t -= 8;
-           } while (t >= 8);
-            break;
-        case OLED_COLOR_BLACK:
-            do
-            {
-               ctx->buffer[index] = 0x00;
-               index += ctx->width;
-               t -= 8;
-            } while (t >= 8);
-            break;
-        case OLED_COLOR_INVERT:
-            do
-            {
-                ctx->buffer[index] = ~ctx->buffer[index];
-                index += ctx->width;
-                t -= 8;
-            } while (t >= 8);
-            break;
-        }
+        dmsg_err_puts("OLED sprites not available in display list or console mode, or with double buffering.");
+        return false;
     }
-    if (t) // // partial line at bottom
+    ctx->sprites = zalloc(OLED_MAX_SPRITES * sizeof(oled_sprite));
+    if (ctx->sprites == NULL)
     {
-        mod = t & 7;
-        static const uint8_t postmask[8] = {0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F };
-        mask = postmask[mod];
-        switch (color)
-        {
-        case OLED_COLOR_WHITE:
-            ctx->buffer[index] |= mask;
-            break;
-        case OLED_COLOR_BLACK:
-            ctx->buffer[index] &= ~mask;
-            break;
-        case OLED_COLOR_INVERT:
-            ctx->buffer[index] ^= mask;
-            break;
-        }
+        dmsg_err_puts("Alloc OLED sprites failed.");
+        return false;
     }
-draw_vline_finish:
-    if (ctx->refresh_left > x) ctx->refresh_left = x;
-    if (ctx->refresh_right < x) ctx->refresh_right = x;
-    if (ctx->refresh_top > y) ctx->refresh_top = y;
-    if (ctx->refresh_bottom < y + h - 1) ctx->refresh_bottom = y + h - 1;
-    return;
+    if (ctx->frame)
+        return true;    // Composed already for the canvas
+    ctx->frame = zalloc(_WIDTH(ctx) * _HEIGHT(ctx) / 8);
+    if (ctx->frame == NULL)
+    {
+        dmsg_err_puts("Alloc OLED frame buffer failed.");
+        free(ctx->sprites);
+        ctx->sprites = NULL;
+        return false;
+    }
+    memcpy(ctx->frame, ctx->buffer, _WIDTH(ctx) * _HEIGHT(ctx) / 8);
+    return true;
 }
 
 
-void ICACHE_FLASH_ATTR oled_draw_rectangle(uint8_t id, int8_t x, int8_t y, uint8_t w, uint8_t h, oled_color_t color)
+int8_t ICACHE_FLASH_ATTR oled_sprite_add(uint8_t id, oled_coord_t x, oled_coord_t y, const uint8_t *bitmap, const uint8_t *mask,
+                                         uint8_t w, uint8_t h, uint8_t z)
 {
-    oled_draw_hline(id, x, y, w, color);
-    oled_draw_hline(id, x, y + h - 1, w, color);
-    oled_draw_vline(id, x, y, h, color);
-    oled_draw_vline(id, x + w - 1, y, h, color);
+    oled_i2c_ctx *ctx = _CTX(id);
+    oled_sprite *sp;
+    int8_t i;
+
+    if ((ctx == NULL) || (ctx->sprites == NULL) || (bitmap == NULL) || (w == 0) || (h == 0))
+        return -1;
+    for (i = 0; i < OLED_MAX_SPRITES; ++i)
+    {
+        sp = ctx->sprites + i;
+        if (sp->bitmap)
+            continue;
+        sp->bitmap = bitmap;
+        sp->mask = mask;
+        sp->x = x;
+        sp->y = y;
+        sp->w = w;
+        sp->h = h;
+        sp->z = z;
+        sp->visible = true;
+        _invalidate(ctx, sp);
+        return i;
+    }
+    dmsg_err_puts("OLED sprite pool full.");
+    return -1;
 }
 
 
-void ICACHE_FLASH_ATTR oled_fill_rectangle(uint8_t id, int8_t x, int8_t y, uint8_t w, uint8_t h, oled_color_t color)
+void ICACHE_FLASH_ATTR oled_sprite_remove(uint8_t id, int8_t sprite)
 {
-    // Can be optimized?
-    uint8_t i;
-    for (i = x; i < x + w; ++i)
-        oled_draw_vline(id, i, y, h, color);
+    oled_sprite *sp = _sprite(id, sprite);
+
+    if (sp == NULL)
+        return;
+    _invalidate(_ctxs[id], sp);
+    memset(sp, 0, sizeof(oled_sprite));
 }
 
 
-void ICACHE_FLASH_ATTR oled_draw_circle(uint8_t id, int8_t x0, int8_t y0, uint8_t r, oled_color_t color)
+void ICACHE_FLASH_ATTR oled_sprite_move(uint8_t id, int8_t sprite, oled_coord_t x, oled_coord_t y)
 {
-    // Refer to http://en.wikipedia.org/wiki/Midpoint_circle_algorithm for the algorithm
-
-    oled_i2c_ctx *ctx = _ctxs[id];
-    int8_t x = r;
-    int8_t y = 1;
-    int16_t radius_err = 1 - x;
+    oled_sprite *sp = _sprite(id, sprite);
 
-    if (ctx == NULL)
-        return;
-
-    if (r == 0)
+    if ((sp == NULL) || ((sp->x == x) && (sp->y == y)))
         return;
+    _invalidate(_ctxs[id], sp);
+    sp->x = x;
+    sp->y = y;
+    _invalidate(_ctxs[id], sp);
+}
 
-    oled_draw_pixel(id, x0 - r, y0,     color);
-    oled_draw_pixel(id, x0 + r, y0,     color);
-    oled_draw_pixel(id, x0,     y0 - r, color);
-    oled_draw_pixel(id, x0,     y0 + r, color);
 
-    while (x >= y)
-    {
-        oled_draw_pixel(id, x0 + x, y0 + y, color);
-        oled_draw_pixel(id, x0 - x, y0 + y, color);
-        oled_draw_pixel(id, x0 + x, y0 - y, color);
-        oled_draw_pixel(id, x0 - x, y0 - y, color);
-        if (x != y)
-        {
-            /* Otherwise the 4 drawings below are the same as above, causing
-             * problem when color is INVERT
-             */
-            oled_draw_pixel(id, x0 + y, y0 + x, color);
-            oled_draw_pixel(id, x0 - y, y0 + x, color);
-            oled_draw_pixel(id, x0 + y, y0 - x, color);
-            oled_draw_pixel(id, x0 - y, y0 - x, color);
-        }
-        ++y;
-        if (radius_err < 0)
-        {
-            radius_err += 2 * y + 1;
-        }
-        else
-        {
-            --x;
-            radius_err += 2 * (y - x + 1);
-        }
+void ICACHE_FLASH_ATTR oled_sprite_show(uint8_t id, int8_t sprite, bool visible)
+{
+    oled_sprite *sp = _sprite(id, sprite);
 
-    }
+    if ((sp == NULL) || (sp->visible == visible))
+        return;
+    sp->visible = true;
+    _invalidate(_ctxs[id], sp);
+    sp->visible = visible;
 }
 
 
-void ICACHE_FLASH_ATTR oled_fill_circle(uint8_t id, int8_t x0, int8_t y0, uint8_t r, oled_color_t color)
+void ICACHE_FLASH_ATTR oled_sprite_set_bitmap(uint8_t id, int8_t sprite, const uint8_t *bitmap, const uint8_t *mask)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    int8_t x = 1;
-    int8_t y = r;
-    int16_t radius_err = 1 - y;
-    int8_t x1;
+    oled_sprite *sp = _sprite(id, sprite);
 
-    if (ctx == NULL)
+    if ((sp == NULL) || (bitmap == NULL))
         return;
+    sp->bitmap = bitmap;
+    sp->mask = mask;
+    _invalidate(_ctxs[id], sp);
+}
 
-    if (r == 0)
-        return;
 
-    oled_draw_vline(id, x0, y0 - r, 2 * r + 1, color); // Center vertical line
-    while (y >= x)
+/**
+ * @brief   Find character descriptor, falls back to space for characters not in the font
+ * @return  Descriptor, NULL if neither the character nor space is in the font
+ */
+LOCAL const font_char_desc_t * ICACHE_FLASH_ATTR _glyph(const font_info_t *font, uint16_t cp)
+{
+    const font_range_t *r;
+    uint16_t lo, hi, mid;
+
+    if (font->ranges == NULL)
     {
-        oled_draw_vline(id, x0 - x, y0 - y, 2 * y + 1, color);
-        oled_draw_vline(id, x0 + x, y0 - y, 2 * y + 1, color);
-        if (color != OLED_COLOR_INVERT)
-        {
-            oled_draw_vline(id, x0 - y, y0 - x, 2 * x + 1, color);
-            oled_draw_vline(id, x0 + y, y0 - x, 2 * x + 1, color);
-        }
-        ++x;
-        if (radius_err < 0)
-        {
-            radius_err += 2 * x + 1;
-        }
-        else
-        {
-            --y;
-            radius_err += 2 * (x - y + 1);
-        }
+        if ((cp >= font->char_start) && (cp <= font->char_end))
+            return font->char_descriptors + (cp - font->char_start);
     }
-
-    if (color == OLED_COLOR_INVERT)
+    else
     {
-        x1 = x; // Save where we stopped
-
-        y = 1;
-        x = r;
-        radius_err = 1 - x;
-        oled_draw_hline(id, x0 + x1, y0, r - x1 + 1, color);
-        oled_draw_hline(id, x0 - r, y0, r - x1 + 1, color);
-        while (x >= y)
+        // Binary search the sorted ranges
+        lo = 0;
+        hi = font->range_count;
+        while (lo < hi)
         {
-            oled_draw_hline(id, x0 + x1, y0 - y, x - x1 + 1, color);
-            oled_draw_hline(id, x0 + x1, y0 + y, x - x1 + 1, color);
-            oled_draw_hline(id, x0 - x,  y0 - y, x - x1 + 1, color);
-            oled_draw_hline(id, x0 - x,  y0 + y, x - x1 + 1, color);
-            ++y;
-            if (radius_err < 0)
-            {
-                radius_err += 2 * y + 1;
-            }
+            mid = (lo + hi) / 2;
+            r = font->ranges + mid;
+            if (cp < r->first)
+                hi = mid;
+            else if (cp > r->last)
+                lo = mid + 1;
             else
-            {
-                --x;
-                radius_err += 2 * (y - x + 1);
-            }
+                return font->char_descriptors + r->index + (cp - r->first);
         }
     }
+    return (cp != ' ') ? _glyph(font, ' ') : NULL;
 }
 
 
-void ICACHE_FLASH_ATTR oled_select_font(uint8_t id, uint8_t idx)
+/**
+ * @brief   Decode one character from UTF-8 string and advance past it
+ * @remark  Bytes that do not start a valid sequence are returned as they are, so strings in an 8-bit
+ *          character set (e.g. the CP437 symbols of glcd 5x7) keep working. Characters beyond the
+ *          16-bit range are returned as U+FFFD.
+ */
+LOCAL uint16_t ICACHE_FLASH_ATTR _utf8_next(const char **str)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
+    const uint8_t *s = (const uint8_t *)*str;
+    uint16_t cp = s[0];
 
-    if (ctx == NULL)
-            return;
-    if (idx < OLED_NUM_FONTS)
-        ctx->font = oled_fonts[idx];
+    if ((s[0] >= 0xc2) && (s[0] <= 0xdf) && ((s[1] & 0xc0) == 0x80))
+    {
+        cp = ((s[0] & 0x1f) << 6) | (s[1] & 0x3f);
+        *str += 2;
+    }
+    else if (((s[0] & 0xf0) == 0xe0) && ((s[1] & 0xc0) == 0x80) && ((s[2] & 0xc0) == 0x80)
+        && ((s[0] != 0xe0) || (s[1] >= 0xa0)))
+    {
+        cp = ((s[0] & 0x0f) << 12) | ((s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+        *str += 3;
+    }
+    else if ((s[0] >= 0xf0) && (s[0] <= 0xf4) && ((s[1] & 0xc0) == 0x80) && ((s[2] & 0xc0) == 0x80)
+        && ((s[3] & 0xc0) == 0x80))
+    {
+        cp = 0xfffd;
+        *str += 4;
+    }
+    else
+    {
+        *str += 1;
+    }
+    return cp;
 }
 
 
-// return character width
-uint8_t ICACHE_FLASH_ATTR oled_draw_char(uint8_t id, uint8_t x, uint8_t y, char c, oled_color_t foreground, oled_color_t background)
+/**
+ * @brief   Paint character, in panel coordinates
+ * @return  Character width
+ */
+LOCAL uint8_t ICACHE_FLASH_ATTR _draw_char(oled_i2c_ctx *ctx, int16_t x, int16_t y, uint16_t c, oled_color_t foreground, oled_color_t background)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint8_t i, j;
-    const uint8_t *bitmap;
-    uint8_t line;
+    const font_char_desc_t *desc = _glyph(ctx->font, c);
+
+    if (desc == NULL)
+        return 0;
+    _blit(ctx, x, y, ctx->font->bitmap + desc->offset, NULL, desc->width, ctx->font->height, false, foreground, background);
+    return (desc->width);
+}
+
+
+uint8_t ICACHE_FLASH_ATTR oled_draw_char(uint8_t id, oled_coord_t x, oled_coord_t y, uint16_t c, oled_color_t foreground, oled_color_t background)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    const font_char_desc_t *desc;
 
     if (ctx == NULL)
         return 0;
@@ -787,50 +3287,23 @@ uint8_t ICACHE_FLASH_ATTR oled_draw_char(uint8_t id, uint8_t x, uint8_t y, char
     if (ctx->font == NULL)
         return 0;
 
-    // we always have space in the font set
-    if ((c < ctx->font->char_start) || (c > ctx->font->char_end))
-        c = ' ';
-    c = c - ctx->font->char_start;   // c now become index to tables
-    bitmap = ctx->font->bitmap + ctx->font->char_descriptors[c].offset;
-    for (j = 0; j < ctx->font->height; ++j)
+    if (_RECORDING(ctx))
     {
-        for (i = 0; i < ctx->font->char_descriptors[c].width; ++i)
-        {
-            if (i % 8 == 0)
-            {
-                line = bitmap[(ctx->font->char_descriptors[c].width + 7) / 8 * j + i / 8]; // line data
-            }
-            if (line & 0x80)
-            {
-                oled_draw_pixel(id, x + i, y + j, foreground);
-            }
-            else
-            {
-                switch (background)
-                {
-                case OLED_COLOR_TRANSPARENT:
-                    // Not drawing for transparent background
-                    break;
-                case OLED_COLOR_WHITE:
-                case OLED_COLOR_BLACK:
-                    oled_draw_pixel(id, x + i, y + j, background);
-                    break;
-                case OLED_COLOR_INVERT:
-                    // I don't know why I need invert background
-                    break;
-                }
-            }
-            line = line << 1;
-        }
+        uint8_t op[] = { _OP_CHAR, _C16(x), _C16(y), c & 0xff, c >> 8, foreground, background };
+        desc = _glyph(ctx->font, c);
+        if (desc == NULL)
+            return 0;
+        _record(ctx, op, sizeof(op), x, y, x + desc->width - 1, y + ctx->font->height - 1);
+        return (desc->width);
     }
-    return (ctx->font->char_descriptors[c].width);
+    return _draw_char(ctx, x + ctx->view.x, y + ctx->view.y, c, foreground, background);
 }
 
 
-uint8_t ICACHE_FLASH_ATTR oled_draw_string(uint8_t id, uint8_t x, uint8_t y, char *str, oled_color_t foreground, oled_color_t background)
+uint16_t ICACHE_FLASH_ATTR oled_draw_string(uint8_t id, oled_coord_t x, oled_coord_t y, char *str, oled_color_t foreground, oled_color_t background)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint8_t t = x;
+    oled_i2c_ctx *ctx = _CTX(id);
+    int16_t px, py;
 
     if (ctx == NULL)
         return 0;
@@ -841,24 +3314,41 @@ uint8_t ICACHE_FLASH_ATTR oled_draw_string(uint8_t id, uint8_t x, uint8_t y, cha
     if (str == NULL)
         return 0;
 
+    if (_RECORDING(ctx))
+    {
+        // String is copied with its terminator, so the caller's buffer can be reused
+        uint8_t op[] = { _OP_TEXT, _C16(x), _C16(y), foreground, background };
+        uint16_t len = strlen(str) + 1;
+        uint8_t *d = _reserve(ctx, sizeof(op) + len);
+        uint16_t w = oled_measure_string(id, str);
+        if (d)
+        {
+            memcpy(d, op, sizeof(op));
+            memcpy(d + sizeof(op), str, len);
+            _mark_view(ctx, x, y, x + w - 1, y + ctx->font->height - 1);
+        }
+        return w;
+    }
+
+    px = x + ctx->view.x;
+    py = y + ctx->view.y;
     while (*str)
     {
-       x += oled_draw_char(id, x, y, *str, foreground, background);
-       ++str;
+       px += _draw_char(ctx, px, py, _utf8_next((const char **)&str), foreground, background);
        if (*str)
-           x += ctx->font->c;
+           px += ctx->font->c;
     }
 
-    return (x - t);
+    return (px - x - ctx->view.x);
 }
 
 
 // return width of string
-uint8_t ICACHE_FLASH_ATTR oled_measure_string(uint8_t id, char *str)
+uint16_t ICACHE_FLASH_ATTR oled_measure_string(uint8_t id, char *str)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint8_t w = 0;
-    char c;
+    oled_i2c_ctx *ctx = _CTX(id);
+    const font_char_desc_t *desc;
+    uint16_t w = 0;
 
     if (ctx == NULL)
         return 0;
@@ -868,13 +3358,9 @@ uint8_t ICACHE_FLASH_ATTR oled_measure_string(uint8_t id, char *str)
 
     while (*str)
     {
-        c = *str;
-        // we always have space in the font set
-        if ((c < ctx->font->char_start) || (c > ctx->font->char_end))
-            c = ' ';
-        c = c - ctx->font->char_start;   // c now become index to tables
-        w += ctx->font->char_descriptors[c].width;
-        ++str;
+        desc = _glyph(ctx->font, _utf8_next((const char **)&str));
+        if (desc)
+            w += desc->width;
        if (*str)
            w += ctx->font->c;
     }
@@ -884,7 +3370,7 @@ uint8_t ICACHE_FLASH_ATTR oled_measure_string(uint8_t id, char *str)
 
 uint8_t ICACHE_FLASH_ATTR oled_get_font_height(uint8_t id)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
+    oled_i2c_ctx *ctx = _CTX(id);
 
     if (ctx == NULL)
         return 0;
@@ -898,7 +3384,7 @@ uint8_t ICACHE_FLASH_ATTR oled_get_font_height(uint8_t id)
 
 uint8_t ICACHE_FLASH_ATTR oled_get_font_c(uint8_t id)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
+    oled_i2c_ctx *ctx = _CTX(id);
 
     if (ctx == NULL)
         return 0;
@@ -909,29 +3395,154 @@ uint8_t ICACHE_FLASH_ATTR oled_get_font_c(uint8_t id)
     return (ctx->font->c);
 }
 
+bool ICACHE_FLASH_ATTR oled_set_console(uint8_t id, bool enable)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if (ctx == NULL)
+        return false;
+
+    if (!enable)
+    {
+        if (!ctx->console)
+            return true;
+        ctx->console = false;
+        if (ctx->ring_top || ctx->ring_moved)
+        {
+            // Display RAM page 0 back at the top, panel shows the buffer out of place until refresh
+            ctx->ring_top = 0;
+            ctx->ring_moved = false;
+            _start_line(ctx);
+            _mark_dirty(ctx, 0, 0, _WIDTH(ctx) - 1, _HEIGHT(ctx) - 1);
+            ctx->shadow_stale = true;
+        }
+        return true;
+    }
+    if (ctx->console)
+        return true;
+    if (ctx->list || ctx->front || ctx->frame || ctx->own)
+    {
+        dmsg_err_puts("OLED console not available in display list mode, with double buffering, sprites, canvas or attached buffer.");
+        return false;
+    }
+    ctx->console = true;
+    ctx->con_x = 0;
+    ctx->con_page = 0;
+    oled_clear(id);
+    return true;
+}
+
+
+/**
+ * @brief   Move panel content up by whole pages. The buffer and its dirty spans move along with
+ *          the display RAM ring, so only the cleared pages exposed at the bottom are dirty.
+ */
+LOCAL void ICACHE_FLASH_ATTR _console_scroll(oled_i2c_ctx *ctx, uint8_t pages)
+{
+    uint8_t n = _HEIGHT(ctx) / 8, w = _WIDTH(ctx), p;
+
+    if (pages > n)
+        pages = n;
+    memmove(ctx->buffer, ctx->buffer + pages * w, (n - pages) * w);
+    memset(ctx->buffer + (n - pages) * w, 0, pages * w);
+    memmove(ctx->dirty_left, ctx->dirty_left + pages, n - pages);
+    memmove(ctx->dirty_right, ctx->dirty_right + pages, n - pages);
+    for (p = n - pages; p < n; ++p)
+    {
+        ctx->dirty_left[p] = 0;
+        ctx->dirty_right[p] = w - 1;
+    }
+    ctx->ring_top = (ctx->ring_top + pages) % ctx->type->ram_pages;
+    ctx->ring_moved = true;
+    // Exposed pages hold whatever display RAM had there
+    ctx->shadow_stale = true;
+}
+
+
+void ICACHE_FLASH_ATTR oled_console_scroll(uint8_t id, uint8_t pages)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+
+    if ((ctx == NULL) || !ctx->console || (pages == 0))
+        return;
+    _console_scroll(ctx, pages);
+}
+
+
+//! @brief Start a new console line below the current one, scroll if it does not fit
+LOCAL void ICACHE_FLASH_ATTR _console_newline(oled_i2c_ctx *ctx, uint8_t pages)
+{
+    uint8_t n = _HEIGHT(ctx) / 8;
+
+    ctx->con_x = 0;
+    if (ctx->con_page + 2 * pages <= n)
+    {
+        ctx->con_page += pages;
+        return;
+    }
+    _console_scroll(ctx, ctx->con_page + 2 * pages - n);
+    ctx->con_page = n - pages;
+}
+
+
+void ICACHE_FLASH_ATTR oled_console_write(uint8_t id, const char *str)
+{
+    oled_i2c_ctx *ctx = _CTX(id);
+    const font_char_desc_t *desc;
+    uint8_t pages;
+    uint16_t c;
+
+    if ((ctx == NULL) || !ctx->console || (ctx->font == NULL) || (str == NULL))
+        return;
+
+    // A line takes whole pages, so scrolling one line moves the start line by whole pages
+    pages = (ctx->font->height + 7) / 8;
+    while (*str)
+    {
+        c = _utf8_next(&str);
+        if (c == '\r')
+            continue;
+        if (c == '\n')
+        {
+            _console_newline(ctx, pages);
+            continue;
+        }
+        desc = _glyph(ctx->font, c);
+        if (desc == NULL)
+            continue;
+        if ((ctx->con_x > 0) && (ctx->con_x + desc->width > _WIDTH(ctx)))
+            _console_newline(ctx, pages);
+        ctx->con_x += _draw_char(ctx, ctx->con_x, ctx->con_page * 8, c, OLED_COLOR_WHITE, OLED_COLOR_BLACK) + ctx->font->c;
+    }
+}
+
+
 // Hint, the display is 16 rows tall. To scroll the whole display, run:
 // oled_start_scroll_right(0x00, 0x0f)
 void ICACHE_FLASH_ATTR oled_start_scroll_right(uint8_t id, uint8_t start, uint8_t stop)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
+    oled_i2c_ctx *ctx = _CTX(id);
 
-    if (ctx == NULL)
+    if ((ctx == NULL) || ctx->type->page_mode || ctx->console)
         return;
+    _wait_idle(ctx);
 
-    _command(ctx->address, 0x26); // SSD1306_RIGHT_HORIZONTAL_SCROLL
-    _command(ctx->address, 0x00);
-    _command(ctx->address, start);
-    _command(ctx->address, 0x00);
-    _command(ctx->address, stop);
-    _command(ctx->address, 0x01);
-    _command(ctx->address, 0Xff);
-    _command(ctx->address, 0x2f); // SSD1306_ACTIVATE_SCROLL
+    const uint8_t cmds[] =
+    {
+        0x26,   // SSD1306_RIGHT_HORIZONTAL_SCROLL
+        0x00,
+        start,
+        0x00,
+        stop,
+        0x01,
+        0xff,
+        0x2f,   // SSD1306_ACTIVATE_SCROLL
+    };
+    _commands(ctx, cmds, sizeof(cmds));
 
     // Invalidate whole screen for next refresh
-    ctx->refresh_top = 0;
-    ctx->refresh_left = 0;
-    ctx->refresh_right = ctx->width - 1;
-    ctx->refresh_bottom = ctx->height - 1;
+    _mark_dirty(ctx, 0, 0, _WIDTH(ctx) - 1, _HEIGHT(ctx) - 1);
+    ctx->shadow_stale = true;
 }
 
 
@@ -939,25 +3550,28 @@ void ICACHE_FLASH_ATTR oled_start_scroll_right(uint8_t id, uint8_t start, uint8_
 // oled_start_scroll_left(0x00, 0x0f)
 void ICACHE_FLASH_ATTR oled_start_scroll_left(uint8_t id, uint8_t start, uint8_t stop)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
+    oled_i2c_ctx *ctx = _CTX(id);
 
-    if (ctx == NULL)
+    if ((ctx == NULL) || ctx->type->page_mode || ctx->console)
         return;
+    _wait_idle(ctx);
 
-    _command(ctx->address, 0x27); // SSD1306_LEFT_HORIZONTAL_SCROLL
-    _command(ctx->address, 0x00);
-    _command(ctx->address, start);
-    _command(ctx->address, 0x00);
-    _command(ctx->address, stop);
-    _command(ctx->address, 0x01);
-    _command(ctx->address, 0Xff);
-    _command(ctx->address, 0x2f); // SSD1306_ACTIVATE_SCROLL
+    const uint8_t cmds[] =
+    {
+        0x27,   // SSD1306_LEFT_HORIZONTAL_SCROLL
+        0x00,
+        start,
+        0x00,
+        stop,
+        0x01,
+        0xff,
+        0x2f,   // SSD1306_ACTIVATE_SCROLL
+    };
+    _commands(ctx, cmds, sizeof(cmds));
 
     // Invalidate whole screen for next refresh
-    ctx->refresh_top = 0;
-    ctx->refresh_left = 0;
-    ctx->refresh_right = ctx->width - 1;
-    ctx->refresh_bottom = ctx->height - 1;
+    _mark_dirty(ctx, 0, 0, _WIDTH(ctx) - 1, _HEIGHT(ctx) - 1);
+    ctx->shadow_stale = true;
 }
 
 
@@ -965,27 +3579,30 @@ void ICACHE_FLASH_ATTR oled_start_scroll_left(uint8_t id, uint8_t start, uint8_t
 // oled_start_scroll_diag_right(0x00, 0x0f)
 void ICACHE_FLASH_ATTR oled_start_scroll_diag_right(uint8_t id, uint8_t start, uint8_t stop)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
+    oled_i2c_ctx *ctx = _CTX(id);
 
-    if (ctx == NULL)
+    if ((ctx == NULL) || ctx->type->page_mode || ctx->console)
         return;
+    _wait_idle(ctx);
 
-    _command(ctx->address, 0xa3); // SSD1306_SET_VERTICAL_SCROLL_AREA
-    _command(ctx->address, 0x00);
-    _command(ctx->address, ctx->height);
-    _command(ctx->address, 0x29); // SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL
-    _command(ctx->address, 0x00);
-    _command(ctx->address, start);
-    _command(ctx->address, 0x00);
-    _command(ctx->address, stop);
-    _command(ctx->address, 0x01);
-    _command(ctx->address, 0x2f); // SSD1306_ACTIVATE_SCROLL
+    const uint8_t cmds[] =
+    {
+        0xa3,         // SSD1306_SET_VERTICAL_SCROLL_AREA
+        0x00,
+        _HEIGHT(ctx),
+        0x29,         // SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL
+        0x00,
+        start,
+        0x00,
+        stop,
+        0x01,
+        0x2f,         // SSD1306_ACTIVATE_SCROLL
+    };
+    _commands(ctx, cmds, sizeof(cmds));
 
     // Invalidate whole screen for next refresh
-    ctx->refresh_top = 0;
-    ctx->refresh_left = 0;
-    ctx->refresh_right = ctx->width - 1;
-    ctx->refresh_bottom = ctx->height - 1;
+    _mark_dirty(ctx, 0, 0, _WIDTH(ctx) - 1, _HEIGHT(ctx) - 1);
+    ctx->shadow_stale = true;
 }
 
 
@@ -993,57 +3610,60 @@ void ICACHE_FLASH_ATTR oled_start_scroll_diag_right(uint8_t id, uint8_t start, u
 // oled_start_scroll_diag_left(0x00, 0x0f)
 void ICACHE_FLASH_ATTR oled_start_scroll_diag_left(uint8_t id, uint8_t start, uint8_t stop)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
+    oled_i2c_ctx *ctx = _CTX(id);
 
-    if (ctx == NULL)
+    if ((ctx == NULL) || ctx->type->page_mode || ctx->console)
         return;
+    _wait_idle(ctx);
 
-    _command(ctx->address, 0xa3); // SSD1306_SET_VERTICAL_SCROLL_AREA
-    _command(ctx->address, 0x00);
-    _command(ctx->address, ctx->height);
-    _command(ctx->address, 0x2a); // SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL
-    _command(ctx->address, 0x00);
-    _command(ctx->address, start);
-    _command(ctx->address, 0x00);
-    _command(ctx->address, stop);
-    _command(ctx->address, 0x01);
-    _command(ctx->address, 0x2f); // SSD1306_ACTIVATE_SCROLL
+    const uint8_t cmds[] =
+    {
+        0xa3,         // SSD1306_SET_VERTICAL_SCROLL_AREA
+        0x00,
+        _HEIGHT(ctx),
+        0x2a,         // SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL
+        0x00,
+        start,
+        0x00,
+        stop,
+        0x01,
+        0x2f,         // SSD1306_ACTIVATE_SCROLL
+    };
+    _commands(ctx, cmds, sizeof(cmds));
 
     // Invalidate whole screen for next refresh
-    ctx->refresh_top = 0;
-    ctx->refresh_left = 0;
-    ctx->refresh_right = ctx->width - 1;
-    ctx->refresh_bottom = ctx->height - 1;
+    _mark_dirty(ctx, 0, 0, _WIDTH(ctx) - 1, _HEIGHT(ctx) - 1);
+    ctx->shadow_stale = true;
 }
 
 
 void ICACHE_FLASH_ATTR oled_stop_scroll(uint8_t id)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
+    oled_i2c_ctx *ctx = _CTX(id);
 
-    if (ctx == NULL)
+    if ((ctx == NULL) || ctx->type->page_mode || ctx->console)
         return;
-    _command(ctx->address, 0x2e); // SSD1306_DEACTIVATE_SCROLL
+    _wait_idle(ctx);
+    _command(ctx, 0x2e); // SSD1306_DEACTIVATE_SCROLL
 
     // Invalidate whole screen for next refresh
-    ctx->refresh_top = 0;
-    ctx->refresh_left = 0;
-    ctx->refresh_right = ctx->width - 1;
-    ctx->refresh_bottom = ctx->height - 1;
+    _mark_dirty(ctx, 0, 0, _WIDTH(ctx) - 1, _HEIGHT(ctx) - 1);
+    ctx->shadow_stale = true;
 }
 
 
 void ICACHE_FLASH_ATTR oled_invert_display(uint8_t id, bool invert)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
+    oled_i2c_ctx *ctx = _CTX(id);
 
     if (ctx == NULL)
         return;
+    _wait_idle(ctx);
 
     if (invert)
-        _command(ctx->address, 0xa7); // SSD1306_INVERTDISPLAY
+        _command(ctx, 0xa7); // SSD1306_INVERTDISPLAY
     else
-        _command(ctx->address, 0xa6); // SSD1306_NORMALDISPLAY
+        _command(ctx, 0xa6); // SSD1306_NORMALDISPLAY
 
 }
 
@@ -7,7 +7,9 @@
 
 
 #include "esp_common.h"
-#include "ssd1306.h"
+#include "i2c.h"
+#include "i2c_bus.h"
+#include "oled.h"
 #include "dmsg.h"
 #include "shell.h"
 
@@ -56,25 +58,19 @@ shell_errno_t ICACHE_FLASH_ATTR shell_do_write(const char* args)
 {
     // Testing 24L02 write
     uint8_t ad, i;
+    uint8_t page[9];
     ad = 0;
-    bool ack;
     do
     {
-        ack = false;
-        while (!ack) // wait until device acknowledge
+        page[0] = ad;   // word address
+        for (i = 1; i < sizeof(page); ++i)
         {
-            i2c_start();
-            ack = i2c_write(0xA0);
-            if (!ack)
-                os_delay_us(1000);
-        }
-        i2c_write(ad);
-        for (i = 0; i < 8; ++i)
-        {
-            i2c_write(ad);
+            page[i] = ad;
             ++ad;
         }
-        i2c_stop();
+        // wait until device acknowledge
+        while (!i2c_bus_write_read(I2C_BUS_PRIO_NORMAL, 0xA0, page, sizeof(page), NULL, 0))
+            os_delay_us(1000);
         os_delay_us(4000);
     } while (ad != 0);
     return SHELL_EOK;
@@ -86,19 +82,12 @@ shell_errno_t ICACHE_FLASH_ATTR shell_do_read(const char* args)
     // Testing 24L02 read
     uint8_t i;
     uint8_t c[256];
-    i2c_start();
-    i2c_write(0xA0); // write
-    i2c_write(0x00); // address
-    i2c_start();
-    i2c_write(0xA1); // read
-    for (i = 0; i != 255; ++i)
+    uint8_t ad = 0x00;
+    if (!i2c_bus_write_read(I2C_BUS_PRIO_NORMAL, 0xA0, &ad, 1, c, sizeof(c)))
     {
-        c[i] = i2c_read();
-        i2c_set_ack(true);
+        shell_puts("EEPROM read failed.\r\n");
+        return SHELL_EOK;
     }
-    c[i] = i2c_read();
-    i2c_set_ack(false);
-    i2c_stop();
     i = 0;
     do
     {
@@ -113,45 +102,146 @@ shell_errno_t ICACHE_FLASH_ATTR shell_do_read(const char* args)
 
 shell_errno_t ICACHE_FLASH_ATTR shell_do_init(const char* args)
 {
-    if (ssd1306_init(0))
-        shell_puts("Init OLED0 OK\r\n");
-    else
-        shell_puts("Init OLED0 failed\r\n");
-    if (ssd1306_init(1))
-        shell_puts("Init OLED1 OK\r\n");
-    else
-        shell_puts("Init OLED1 failed\r\n");
+    uint8_t id;
+    for (id = 0; id < oled_get_panel_count(); ++id)
+    {
+        if (oled_init(id))
+            shell_printf("Init OLED%d OK\r\n", id);
+        else
+            shell_printf("Init OLED%d failed\r\n", id);
+    }
     return SHELL_EOK;
 }
 
 
 shell_errno_t ICACHE_FLASH_ATTR shell_do_term(const char* args)
 {
-    ssd1306_term(0);
-    ssd1306_term(1);
+    uint8_t id;
+    for (id = 0; id < oled_get_panel_count(); ++id)
+        oled_term(id);
     return SHELL_EOK;
 }
 
 
 shell_errno_t ICACHE_FLASH_ATTR shell_do_draw(const char* args)
 {
-    int8_t w;
-    ssd1306_select_font(0, 1);
-    w = ssd1306_measure_string(0, "www.ba0sh1.com");
-    ssd1306_draw_string(0, (ssd1306_get_width(0) - w) / 2, 12, "www.ba0sh1.com", SSD1306_COLOR_WHITE, SSD1306_COLOR_BLACK);
-    ssd1306_refresh(0, false);
+    oled_coord_t w;
+    oled_select_font(0, 1);
+    w = oled_measure_string(0, "www.ba0sh1.com");
+    oled_draw_string(0, (oled_get_width(0) - w) / 2, 12, "www.ba0sh1.com", OLED_COLOR_WHITE, OLED_COLOR_BLACK);
+    oled_refresh(0, false);
 
     for (w = 40; w > 10; w -= 5)
-        ssd1306_draw_circle(1, 64, 40, w, SSD1306_COLOR_WHITE);
-    ssd1306_select_font(1, 1);
-    ssd1306_fill_rectangle(1, 0, 0, 128, 16, SSD1306_COLOR_WHITE);
-    w = ssd1306_measure_string(1, "www.ba0sh1.com");
-    ssd1306_draw_string(1, (ssd1306_get_width(1) - w) / 2, 4, "www.ba0sh1.com", SSD1306_COLOR_BLACK, SSD1306_COLOR_TRANSPARENT);
-    ssd1306_refresh(1, false);
+        oled_draw_circle(1, 64, 40, w, OLED_COLOR_WHITE);
+    oled_select_font(1, 1);
+    oled_fill_rectangle(1, 0, 0, 128, 16, OLED_COLOR_WHITE);
+    w = oled_measure_string(1, "www.ba0sh1.com");
+    oled_draw_string(1, (oled_get_width(1) - w) / 2, 4, "www.ba0sh1.com", OLED_COLOR_BLACK, OLED_COLOR_TRANSPARENT);
+    oled_refresh(1, false);
     return SHELL_EOK;
 }
 
 
+//! @brief Drawing calls timed by BENCH. Call i draws at a position derived from i, on a panel of
+//!        w x h pixels.
+LOCAL void ICACHE_FLASH_ATTR _bench_pixel(uint8_t id, uint16_t i, uint8_t w, uint8_t h)
+{
+    oled_draw_pixel(id, i % w, (i / w) % h, OLED_COLOR_INVERT);
+}
+
+LOCAL void ICACHE_FLASH_ATTR _bench_hline(uint8_t id, uint16_t i, uint8_t w, uint8_t h)
+{
+    oled_draw_hline(id, i % 8, i % h, w - 16, OLED_COLOR_INVERT);
+}
+
+LOCAL void ICACHE_FLASH_ATTR _bench_vline(uint8_t id, uint16_t i, uint8_t w, uint8_t h)
+{
+    oled_draw_vline(id, i % w, i % 8, h - 16, OLED_COLOR_INVERT);
+}
+
+LOCAL void ICACHE_FLASH_ATTR _bench_line(uint8_t id, uint16_t i, uint8_t w, uint8_t h)
+{
+    oled_draw_line(id, 0, i % h, w - 1, h - 1 - i % h, OLED_COLOR_INVERT);
+}
+
+LOCAL void ICACHE_FLASH_ATTR _bench_fill(uint8_t id, uint16_t i, uint8_t w, uint8_t h)
+{
+    oled_fill_rectangle(id, i % 8, i % 8, w / 2, h / 2, OLED_COLOR_INVERT);
+}
+
+LOCAL void ICACHE_FLASH_ATTR _bench_circle(uint8_t id, uint16_t i, uint8_t w, uint8_t h)
+{
+    oled_fill_circle(id, w / 2, h / 2, h / 4 + i % 8, OLED_COLOR_INVERT);
+}
+
+LOCAL void ICACHE_FLASH_ATTR _bench_string(uint8_t id, uint16_t i, uint8_t w, uint8_t h)
+{
+    oled_draw_string(id, i % 8, i % (h - 8), "www.ba0sh1.com", OLED_COLOR_WHITE, OLED_COLOR_BLACK);
+}
+
+typedef struct _bench
+{
+    const char *name;
+    void (*fn)(uint8_t id, uint16_t i, uint8_t w, uint8_t h);
+} bench_t;
+
+LOCAL const bench_t _benches[] =
+{
+    { "pixel", _bench_pixel },
+    { "hline", _bench_hline },
+    { "vline", _bench_vline },
+    { "line", _bench_line },
+    { "fill rectangle", _bench_fill },
+    { "fill circle", _bench_circle },
+    { "string", _bench_string },
+};
+
+#define BENCH_CALLS 1000
+#define BENCH_REFRESHES 10
+
+
+/**
+ * @brief   Time drawing primitives and full refresh on a panel, "BENCH 1" for panel 1. Compare the
+ *          figures of builds with and without OLED_FIXED_WIDTH/HEIGHT in oled_i2c.c.
+ */
+shell_errno_t ICACHE_FLASH_ATTR shell_do_bench(const char* args)
+{
+    uint8_t id = 0, w, h, k;
+    uint16_t i;
+    uint32_t t;
+
+    if (args && (*args >= '0') && (*args <= '9'))
+        id = *args - '0';
+    if (id >= oled_get_panel_count())
+    {
+        shell_printf("No panel %d\r\n", id);
+        return SHELL_EOK;
+    }
+    w = oled_get_width(id);
+    h = oled_get_height(id);
+    if (w == 0)
+    {
+        shell_puts("Panel not initialized\r\n");
+        return SHELL_EOK;
+    }
+    oled_select_font(id, 1);
+    for (k = 0; k < sizeof(_benches) / sizeof(_benches[0]); ++k)
+    {
+        oled_clear(id);
+        t = system_get_time();
+        for (i = 0; i < BENCH_CALLS; ++i)
+            _benches[k].fn(id, i, w, h);
+        t = system_get_time() - t;
+        shell_printf("%-14s %6u us / %u\r\n", _benches[k].name, t, BENCH_CALLS);
+    }
+    t = system_get_time();
+    for (i = 0; i < BENCH_REFRESHES; ++i)
+        oled_refresh(id, true);
+    t = system_get_time() - t;
+    shell_printf("%-14s %6u us / %u\r\n", "refresh", t, BENCH_REFRESHES);
+    return SHELL_EOK;
+}
+
 
 shell_command_t shell_commands[] =
 {
@@ -161,5 +251,6 @@ shell_command_t shell_commands[] =
     {"INIT", shell_do_init},
     {"TERM", shell_do_term},
     {"DRAW", shell_do_draw},
+    {"BENCH", shell_do_bench},
     {0, 0}
 };
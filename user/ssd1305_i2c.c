@@ -1,894 +0,0 @@
-/**
-  ******************************************************************************
-  * @file    ssd1305_i2c.c
-  * @author  Baoshi <mail(at)ba0sh1(dot)com>
-  * @version 0.6
-  * @date    Dec 29, 2014
-  * @brief   SSD1305 I2C OLED driver for ESP8266
-  ******************************************************************************
-  * @copyright
-  *
-  * Many of the work here are based on Adafruit ssd1305 and GFX Arduino library.
-  * Please support Adafruit by purchasing products from Adafruit!
-  *
-  * Copyright (c) 2015, Baoshi Zhu. All rights reserved.
-  * Use of this source code is governed by a BSD-style license that can be
-  * found in the LICENSE.txt file.
-  *
-  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
-  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
-  * ARISING FROM THE USE OF THIS SOFTWARE,
-  *
-  ******************************************************************************
-  */
-
-
-#include "esp_common.h"
-#include "dmsg.h"
-#include "i2c.h"
-#include "fonts.h"
-#include "ssd1305.h"
-
-
-/**
- * @name User configurable panel option block
- * @{
- */
-
-//! @brief Panel 0 type, define to SSD1305_NONE if not used.
-#define PANEL0_TYPE SSD1305_128x64
-//! @brief I2C address for panel 0
-#define PANEL0_ADDR (0x3c << 1)
-//! @brief If panel 0 has external RESET pin, define this as 1
-#define PANEL0_USE_RST 1
-//! @brief GPIO MUX for panel 0 RESET pin
-#define PANEL0_RST_MUX  PERIPHS_IO_MUX_MTDI_U
-//! @brief GPIO FUNC for panel 0 RESET pin
-#define PANEL0_RST_FUNC FUNC_GPIO12
-//! @brief GPIO bit location for panel 0 RESET pin
-#define PANEL0_RST_BIT  BIT12
-
-//! @brief Panel 1 type, define to SSD1305_NONE if not used.
-#define PANEL1_PANEL_TYPE SSD1305_NONE
-//! @brief I2C address for panel 1
-#define PANEL1_ADDR (0x3d << 1)
-//! @brief If panel 1 has external RESET pin, define this as 1
-#define PANEL1_USE_RST 0
-//! @brief GPIO MUX for panel 1 RESET pin
-#define PANEL1_RST_MUX  PERIPHS_IO_MUX_MTMS_U
-//! @brief GPIO FUNC for panel 1 RESET pin
-#define PANEL1_RST_FUNC FUNC_GPIO14
-//! @brief GPIO bit location for panel 1 RESET pin
-#define PANEL1_RST_BIT  BIT14
-
-/** @} */
-
-
-#define SSD1305_NONE       0  //!< not used
-#define SSD1305_128x64     1  //!< 128x32 panel
-
-
-
-LOCAL void ICACHE_FLASH_ATTR _command(uint8_t adress, uint8_t c)
-{
-    bool ret;
-    i2c_start();
-    ret = i2c_write(adress);
-    if (!ret) // NACK
-        i2c_stop();
-    i2c_write(0x00);    // Co = 0, D/C = 0
-    i2c_write(c);
-    i2c_stop();
-}
-
-
-LOCAL void ICACHE_FLASH_ATTR _data(uint8_t adress, uint8_t d)
-{
-    bool ret;
-    i2c_start();
-    ret = i2c_write(adress);
-    if (!ret) // NACK
-        i2c_stop();
-    i2c_write(0x40);    // Co = 0, D/C = 1
-    i2c_write(d);
-    i2c_stop();
-}
-
-
-typedef struct _oled_i2c_ctx
-{
-    uint8_t type;       // Panel type
-    uint8_t address;        // I2C address
-    uint8_t *buffer;        // display buffer
-    uint8_t width;          // panel width (128)
-    uint8_t height;         // panel height (32 or 64)
-    uint8_t id;             // my id
-    uint8_t refresh_top;    // "Dirty" window
-    uint8_t refresh_left;
-    uint8_t refresh_right;
-    uint8_t refresh_bottom;
-    const font_info_t* font;    // current font
-} oled_i2c_ctx;
-
-LOCAL oled_i2c_ctx *_ctxs[2] = { NULL };
-
-
-bool ICACHE_FLASH_ATTR ssd1305_init(uint8_t id)
-{
-    oled_i2c_ctx *ctx = NULL;
-
-    if ((id != 0) && (id != 1))
-        goto oled_init_fail;
-
-    // free old context (if any)
-    ssd1305_term(id);
-
-    ctx = zalloc(sizeof(oled_i2c_ctx));
-    if (ctx == NULL)
-    {
-        dmsg_err_puts("Alloc OLED context failed.");
-        goto oled_init_fail;
-    }
-    if (id == 0)
-    {
-#if (PANEL0_TYPE != 0)
-  #if (PANEL0_TYPE == SSD1305_128x64)
-        ctx->type = SSD1305_128x64;
-        ctx->buffer = zalloc(1024); // 128 * 64 / 8
-        ctx->width = 128;
-        ctx->height = 64;
-  #else
-    #error "Panel 0 undefined"
-  #endif
-        if (ctx->buffer == NULL)
-        {
-            dmsg_err_puts("Alloc OLED buffer failed.");
-            goto oled_init_fail;
-        }
-        ctx->address = PANEL0_ADDR;
-  #if PANEL0_USE_RST
-        // Panel 0 reset
-        PIN_FUNC_SELECT(PANEL0_RST_MUX, PANEL0_RST_FUNC);
-        GPIO_REG_WRITE(GPIO_ENABLE_ADDRESS, GPIO_REG_READ(GPIO_ENABLE_ADDRESS) | PANEL0_RST_BIT);
-        GPIO_REG_WRITE(GPIO_OUT_W1TC_ADDRESS, PANEL0_RST_BIT);
-        os_delay_us(10000);
-        GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, PANEL0_RST_BIT);
-  #endif
-#else
-        dmsg_err_puts("Panel 0 not defined.");
-        goto oled_init_fail;
-#endif
-    }
-    else if (id == 1)
-    {
-#if (PANEL1_PANEL_TYPE != 0)
-  #if (PANEL1_PANEL_TYPE ==SSD1305_128x64)
-        ctx->type = SSD1305_128x64;
-        ctx->buffer = zalloc(1024); // 128 * 64 / 8
-        ctx->width = 128;
-        ctx->height = 64;
-  #else
-     #error "Unknown Panel 1 type"
-  #endif
-        if (ctx->buffer == NULL)
-        {
-            dmsg_err_puts("Alloc OLED buffer failed.");
-            goto oled_init_fail;
-        }
-        ctx->address = PANEL1_ADDR;
-  #if PANEL1_USE_RST
-        // Panel 1 reset
-        PIN_FUNC_SELECT(PANEL1_RST_MUX, PANEL1_RST_FUNC);
-        GPIO_REG_WRITE(GPIO_ENABLE_ADDRESS, GPIO_REG_READ(GPIO_ENABLE_ADDRESS) | PANEL1_RST_BIT);
-        GPIO_REG_WRITE(GPIO_OUT_W1TC_ADDRESS, PANEL1_RST_BIT);
-        os_delay_us(10000);
-        GPIO_REG_WRITE(GPIO_OUT_W1TS_ADDRESS, PANEL1_RST_BIT);
-  #endif
-#else
-        dmsg_err_puts("Panel 1 not defined.");
-        goto oled_init_fail;
-#endif
-    }
-
-    // Panel initialization
-    // Try send I2C address check if the panel is connected
-    i2c_start();
-    if (!i2c_write(ctx->address))
-    {
-        i2c_stop();
-        dmsg_err_puts("OLED I2C bus not responding.");
-        goto oled_init_fail;
-    }
-    i2c_stop();
-
-    // Now we assume all sending will be successful
-    if (ctx->type == SSD1305_128x64)
-    {
-        _command(ctx->address, 0xae); // SSD1305_DISPLAYOFF
-        _command(ctx->address, 0x2e); // SSD1305_DEACTIVATE_SCROLL
-        _command(ctx->address, 0x40); // SSD1305_SETSTARTLINE line #0
-        _command(ctx->address, 0x20); // SSD1306_MEMORYMODE
-        _command(ctx->address, 0x00); // 0x00 act like ks0108
-        _command(ctx->address, 0xd8); // Mono mode & Normal Display
-        _command(ctx->address, 0x00);
-        _command(ctx->address, 0x91); // SSD1305_SETLUT
-        _command(ctx->address, 0x31); // BANK0
-        _command(ctx->address, 0x3f); // Color A
-        _command(ctx->address, 0x3f); // Color B
-        _command(ctx->address, 0x3f); // Color C
-        _command(ctx->address, 0x81); // SSD1305_SETCONTRAST1
-        _command(ctx->address, 0x80);
-        _command(ctx->address, 0x82); // SSD1305_SETCONTRAST2
-        _command(ctx->address, 0x80);
-        _command(ctx->address, 0xa1); // SSD1305_SEGREMAP | 1
-        _command(ctx->address, 0xa4); // SSD1305_DISPLAYALLON_RESUME
-        _command(ctx->address, 0xa6); // SSD1305_NORMALDISPLAY
-        _command(ctx->address, 0xa8); // SSD1305_SETMULTIPLEX
-        _command(ctx->address, 0x3f); // 1/64
-        _command(ctx->address, 0xad); // External VCC
-        _command(ctx->address, 0x8e);
-        _command(ctx->address, 0xc8); // SSD1305_COMSCANDEC
-        _command(ctx->address, 0xd3); // SSD1305_SETDISPLAYOFFSET
-        _command(ctx->address, 0x00); // 0 no offset
-        _command(ctx->address, 0xd5); // SSD1305_SETDISPLAYCLOCKDIV
-        _command(ctx->address, 0x70); // Suggested value 0x70
-        _command(ctx->address, 0xd9); // SSD1305_SETPRECHARGE
-        _command(ctx->address, 0xf2);
-        _command(ctx->address, 0xda); // SSD1305_SETCOMPINS
-        _command(ctx->address, 0x12);
-        _command(ctx->address, 0xdb); // SSD1305_SETVCOMDETECT
-        _command(ctx->address, 0x34);
-    }
-    // Save context
-    ctx->id = id;
-    _ctxs[id] = ctx;
-
-    ssd1305_clear(id);
-    ssd1305_refresh(id, true);
-
-    _command(ctx->address, 0xaf); // SSD1305_DISPLAYON
-
-    return true;
-
-oled_init_fail:
-    if (ctx && ctx->buffer) free(ctx->buffer);
-    if (ctx) free(ctx);
-    return false;
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_term(uint8_t id)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-    if (ctx == NULL)
-       return;
-
-    _command(ctx->address, 0xae); // SSD_DISPLAYOFF
-
-    if (ctx->buffer)
-        free(ctx->buffer);
-    free(ctx);
-
-    _ctxs[id] = NULL;
-}
-
-
-uint8_t ICACHE_FLASH_ATTR ssd1305_get_width(uint8_t id)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-    if (ctx == NULL)
-       return 0;
-
-    return ctx->width;
-}
-
-
-uint8_t ICACHE_FLASH_ATTR ssd1305_get_height(uint8_t id)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-    if (ctx == NULL)
-       return 0;
-
-    return ctx->height;
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_clear(uint8_t id)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-    if (ctx == NULL)
-        return;
-
-    if (ctx->type == SSD1305_128x64)
-    {
-        memset(ctx->buffer, 0, 1024);
-    }
-    ctx->refresh_right = ctx->width - 1;
-    ctx->refresh_bottom = ctx->height - 1;
-    ctx->refresh_top = 0;
-    ctx->refresh_left = 0;
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_refresh(uint8_t id, bool force)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint8_t i,j;
-    uint16_t k;
-    uint8_t page_start, page_end;
-
-    if (ctx == NULL)
-        return;
-
-    if (force)
-    {
-        if (ctx->type == SSD1305_128x64)
-        {
-            // Below is adjusted to UG-2864ASYGG14 memory configuration
-            _command(ctx->address, 0x21); // SSD1306_COLUMNADDR
-            _command(ctx->address, 2);    // column start
-            _command(ctx->address, 129);  // column end
-            _command(ctx->address, 0x22); // SSD1306_PAGEADDR
-            _command(ctx->address, 0);    // page start
-            _command(ctx->address, 7);    // page end (8 pages for 64 rows OLED)
-            for (k = 0; k < 1024; k++)
-            {
-                i2c_start();
-                i2c_write(ctx->address);
-                i2c_write(0x40);
-                for (j = 0; j < 16; ++j)
-                {
-                    i2c_write(ctx->buffer[k]);
-                    ++k;
-                }
-                --k;
-                i2c_stop();
-            }
-        }
-    }
-    else
-    {
-        if ((ctx->refresh_top <= ctx->refresh_bottom) && (ctx->refresh_left <= ctx->refresh_right))
-        {
-            page_start = ctx->refresh_top / 8;
-            page_end = ctx->refresh_bottom / 8;
-            // Below is adjusted to UG-2864ASYGG14 memory configuration
-            _command(ctx->address, 0x21); // SSD1305_COLUMNADDR
-            _command(ctx->address, ctx->refresh_left + 2);    // column start
-            _command(ctx->address, ctx->refresh_right + 2);   // column end
-            _command(ctx->address, 0x22); // SSD1305_PAGEADDR
-            _command(ctx->address, page_start);    // page start
-            _command(ctx->address, page_end); // page end
-            k = 0;
-            for (i = page_start; i <= page_end; ++i)
-            {
-                for (j = ctx->refresh_left; j <= ctx->refresh_right; ++j)
-                {
-                    if (k == 0)
-                    {
-                        i2c_start();
-                        i2c_write(ctx->address);
-                        i2c_write(0x40);
-                    }
-                    i2c_write(ctx->buffer[i * ctx->width + j]);
-                    ++k;
-                    if (k == 16)
-                    {
-                        i2c_stop();
-                        k = 0;
-                    }
-
-                }
-            }
-            if (k != 0) // for last batch if stop was not sent
-                i2c_stop();
-        }
-    }
-    // reset dirty area
-    ctx->refresh_top = 255;
-    ctx->refresh_left = 255;
-    ctx->refresh_right = 0;
-    ctx->refresh_bottom = 0;
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_draw_pixel(uint8_t id, int8_t x, int8_t y, ssd1305_color_t color)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint16_t index;
-
-    if (ctx == NULL)
-        return;
-
-    if ((x >= ctx->width) || (x < 0) || (y >= ctx->height) || (y < 0))
-        return;
-
-    index = x + (y / 8) * ctx->width;
-    switch (color)
-    {
-    case SSD1305_COLOR_WHITE:
-        ctx->buffer[index] |= (1 << (y & 7));
-        break;
-    case SSD1305_COLOR_BLACK:
-        ctx->buffer[index] &= ~(1 << (y & 7));
-        break;
-    case SSD1305_COLOR_INVERT:
-        ctx->buffer[index] ^= (1 << (y & 7));
-        break;
-    }
-    if (ctx->refresh_left > x) ctx->refresh_left = x;
-    if (ctx->refresh_right < x) ctx->refresh_right = x;
-    if (ctx->refresh_top > y) ctx->refresh_top = y;
-    if (ctx->refresh_bottom < y) ctx->refresh_bottom = y;
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_draw_hline(uint8_t id, int8_t x, int8_t y, uint8_t w, ssd1305_color_t color)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint16_t index;
-    uint8_t mask, t;
-
-    if (ctx == NULL)
-        return;
-    // boundary check
-    if ((x >= ctx->width) || (x < 0) || (y >= ctx->height) || (y < 0))
-        return;
-    if (w == 0)
-        return;
-    if (x + w > ctx->width)
-        w = ctx->width - x;
-
-    t = w;
-    index = x + (y / 8) * ctx->width;
-    mask = 1 << (y & 7);
-    switch (color)
-    {
-    case SSD1305_COLOR_WHITE:
-        while (t--)
-        {
-            ctx->buffer[index] |= mask;
-            ++index;
-        }
-        break;
-    case SSD1305_COLOR_BLACK:
-        mask = ~mask;
-        while (t--)
-        {
-            ctx->buffer[index] &= mask;
-            ++index;
-        }
-        break;
-    case SSD1305_COLOR_INVERT:
-        while (t--)
-        {
-            ctx->buffer[index] ^= mask;
-            ++index;
-        }
-        break;
-    }
-    if (ctx->refresh_left > x) ctx->refresh_left = x;
-    if (ctx->refresh_right < x + w - 1) ctx->refresh_right = x + w - 1;
-    if (ctx->refresh_top > y) ctx->refresh_top = y;
-    if (ctx->refresh_bottom < y) ctx->refresh_bottom = y;
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_draw_vline(uint8_t id, int8_t x, int8_t y, uint8_t h, ssd1305_color_t color)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint16_t index;
-    uint8_t mask, mod, t;
-
-    if (ctx == NULL)
-        return;
-    // boundary check
-    if ((x >= ctx->width) || (x < 0) || (y >= ctx->height) || (y < 0))
-        return;
-    if (h == 0)
-        return;
-    if (y + h > ctx->height)
-        h = ctx->height - y;
-
-    t = h;
-    index = x + (y / 8) * ctx->width;
-    mod = y & 7;
-    if (mod) // partial line that does not fit into byte at top
-    {
-        // Magic from Adafruit
-        mod = 8 - mod;
-        static const uint8_t premask[8] = { 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE };
-        mask = premask[mod];
-        if (t < mod)
-            mask &= (0xFF >> (mod - t));
-        switch (color)
-        {
-        case SSD1305_COLOR_WHITE:
-            ctx->buffer[index] |= mask;
-            break;
-        case SSD1305_COLOR_BLACK:
-            ctx->buffer[index] &= ~mask;
-            break;
-        case SSD1305_COLOR_INVERT:
-            ctx->buffer[index] ^= mask;
-            break;
-        }
-        if (t < mod)
-            goto draw_vline_finish;
-        t -= mod;
-        index += ctx->width;
-    }
-    if (t >= 8) // byte aligned line at middle
-    {
-        switch (color)
-        {
-        case SSD1305_COLOR_WHITE:
-            do
-           {
-               ctx->buffer[index] = 0xff;
-               index += ctx->width;
-               t -= 8;
-           } while (t >= 8);
-            break;
-        case SSD1305_COLOR_BLACK:
-            do
-            {
-               ctx->buffer[index] = 0x00;
-               index += ctx->width;
-               t -= 8;
-            } while (t >= 8);
-            break;
-        case SSD1305_COLOR_INVERT:
-            do
-            {
-                ctx->buffer[index] = ~ctx->buffer[index];
-                index += ctx->width;
-                t -= 8;
-            } while (t >= 8);
-            break;
-        }
-    }
-    if (t) // // partial line at bottom
-    {
-        mod = t & 7;
-        static const uint8_t postmask[8] = {0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F };
-        mask = postmask[mod];
-        switch (color)
-        {
-        case SSD1305_COLOR_WHITE:
-            ctx->buffer[index] |= mask;
-            break;
-        case SSD1305_COLOR_BLACK:
-            ctx->buffer[index] &= ~mask;
-            break;
-        case SSD1305_COLOR_INVERT:
-            ctx->buffer[index] ^= mask;
-            break;
-        }
-    }
-draw_vline_finish:
-    if (ctx->refresh_left > x) ctx->refresh_left = x;
-    if (ctx->refresh_right < x) ctx->refresh_right = x;
-    if (ctx->refresh_top > y) ctx->refresh_top = y;
-    if (ctx->refresh_bottom < y + h - 1) ctx->refresh_bottom = y + h - 1;
-    return;
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_draw_rectangle(uint8_t id, int8_t x, int8_t y, uint8_t w, uint8_t h, ssd1305_color_t color)
-{
-    ssd1305_draw_hline(id, x, y, w, color);
-    ssd1305_draw_hline(id, x, y + h - 1, w, color);
-    ssd1305_draw_vline(id, x, y, h, color);
-    ssd1305_draw_vline(id, x + w - 1, y, h, color);
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_fill_rectangle(uint8_t id, int8_t x, int8_t y, uint8_t w, uint8_t h, ssd1305_color_t color)
-{
-    // Can be optimized?
-    uint8_t i;
-    for (i = x; i < x + w; ++i)
-        ssd1305_draw_vline(id, i, y, h, color);
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_draw_circle(uint8_t id, int8_t x0, int8_t y0, uint8_t r, ssd1305_color_t color)
-{
-    // Refer to http://en.wikipedia.org/wiki/Midpoint_circle_algorithm for the algorithm
-
-    oled_i2c_ctx *ctx = _ctxs[id];
-    int8_t x = r;
-    int8_t y = 1;
-    int16_t radius_err = 1 - x;
-
-    if (ctx == NULL)
-        return;
-
-    if (r == 0)
-        return;
-
-    ssd1305_draw_pixel(id, x0 - r, y0,     color);
-    ssd1305_draw_pixel(id, x0 + r, y0,     color);
-    ssd1305_draw_pixel(id, x0,     y0 - r, color);
-    ssd1305_draw_pixel(id, x0,     y0 + r, color);
-
-    while (x >= y)
-    {
-        ssd1305_draw_pixel(id, x0 + x, y0 + y, color);
-        ssd1305_draw_pixel(id, x0 - x, y0 + y, color);
-        ssd1305_draw_pixel(id, x0 + x, y0 - y, color);
-        ssd1305_draw_pixel(id, x0 - x, y0 - y, color);
-        if (x != y)
-        {
-            /* Otherwise the 4 drawings below are the same as above, causing
-             * problem when color is INVERT
-             */
-            ssd1305_draw_pixel(id, x0 + y, y0 + x, color);
-            ssd1305_draw_pixel(id, x0 - y, y0 + x, color);
-            ssd1305_draw_pixel(id, x0 + y, y0 - x, color);
-            ssd1305_draw_pixel(id, x0 - y, y0 - x, color);
-        }
-        ++y;
-        if (radius_err < 0)
-        {
-            radius_err += 2 * y + 1;
-        }
-        else
-        {
-            --x;
-            radius_err += 2 * (y - x + 1);
-        }
-
-    }
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_fill_circle(uint8_t id, int8_t x0, int8_t y0, uint8_t r, ssd1305_color_t color)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-    int8_t x = 1;
-    int8_t y = r;
-    int16_t radius_err = 1 - y;
-    int8_t x1;
-
-    if (ctx == NULL)
-        return;
-
-    if (r == 0)
-        return;
-
-    ssd1305_draw_vline(id, x0, y0 - r, 2 * r + 1, color); // Center vertical line
-    while (y >= x)
-    {
-        ssd1305_draw_vline(id, x0 - x, y0 - y, 2 * y + 1, color);
-        ssd1305_draw_vline(id, x0 + x, y0 - y, 2 * y + 1, color);
-        if (color != SSD1305_COLOR_INVERT)
-        {
-            ssd1305_draw_vline(id, x0 - y, y0 - x, 2 * x + 1, color);
-            ssd1305_draw_vline(id, x0 + y, y0 - x, 2 * x + 1, color);
-        }
-        ++x;
-        if (radius_err < 0)
-        {
-            radius_err += 2 * x + 1;
-        }
-        else
-        {
-            --y;
-            radius_err += 2 * (x - y + 1);
-        }
-    }
-
-    if (color == SSD1305_COLOR_INVERT)
-    {
-        x1 = x; // Save where we stopped
-
-        y = 1;
-        x = r;
-        radius_err = 1 - x;
-        ssd1305_draw_hline(id, x0 + x1, y0, r - x1 + 1, color);
-        ssd1305_draw_hline(id, x0 - r, y0, r - x1 + 1, color);
-        while (x >= y)
-        {
-            ssd1305_draw_hline(id, x0 + x1, y0 - y, x - x1 + 1, color);
-            ssd1305_draw_hline(id, x0 + x1, y0 + y, x - x1 + 1, color);
-            ssd1305_draw_hline(id, x0 - x,  y0 - y, x - x1 + 1, color);
-            ssd1305_draw_hline(id, x0 - x,  y0 + y, x - x1 + 1, color);
-            ++y;
-            if (radius_err < 0)
-            {
-                radius_err += 2 * y + 1;
-            }
-            else
-            {
-                --x;
-                radius_err += 2 * (y - x + 1);
-            }
-        }
-    }
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_select_font(uint8_t id, uint8_t idx)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-
-    if (ctx == NULL)
-            return;
-    if (idx < NUM_FONTS)
-        ctx->font = fonts[idx];
-}
-
-
-// return character width
-uint8_t ICACHE_FLASH_ATTR ssd1305_draw_char(uint8_t id, uint8_t x, uint8_t y, char c, ssd1305_color_t foreground, ssd1305_color_t background)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint8_t i, j;
-    const uint8_t *bitmap;
-    uint8_t line;
-
-    if (ctx == NULL)
-        return 0;
-
-    if (ctx->font == NULL)
-        return 0;
-
-    // we always have space in the font set
-    if ((c < ctx->font->char_start) || (c > ctx->font->char_end))
-        c = ' ';
-    c = c - ctx->font->char_start;   // c now become index to tables
-    bitmap = ctx->font->bitmap + ctx->font->char_descriptors[c].offset;
-    for (j = 0; j < ctx->font->height; ++j)
-    {
-        for (i = 0; i < ctx->font->char_descriptors[c].width; ++i)
-        {
-            if (i % 8 == 0)
-            {
-                line = bitmap[(ctx->font->char_descriptors[c].width + 7) / 8 * j + i / 8]; // line data
-            }
-            if (line & 0x80)
-            {
-                ssd1305_draw_pixel(id, x + i, y + j, foreground);
-            }
-            else
-            {
-                switch (background)
-                {
-                case SSD1305_COLOR_TRANSPARENT:
-                    // Not drawing for transparent background
-                    break;
-                case SSD1305_COLOR_WHITE:
-                case SSD1305_COLOR_BLACK:
-                    ssd1305_draw_pixel(id, x + i, y + j, background);
-                    break;
-                case SSD1305_COLOR_INVERT:
-                    // I don't know why I need invert background
-                    break;
-                }
-            }
-            line = line << 1;
-        }
-    }
-    return (ctx->font->char_descriptors[c].width);
-}
-
-
-uint8_t ICACHE_FLASH_ATTR ssd1305_draw_string(uint8_t id, uint8_t x, uint8_t y, char *str, ssd1305_color_t foreground, ssd1305_color_t background)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint8_t t = x;
-
-    if (ctx == NULL)
-        return 0;
-
-    if (ctx->font == NULL)
-        return 0;
-
-    if (str == NULL)
-        return 0;
-
-    while (*str)
-    {
-       x += ssd1305_draw_char(id, x, y, *str, foreground, background);
-       ++str;
-       if (*str)
-           x += ctx->font->c;
-    }
-
-    return (x - t);
-}
-
-
-// return width of string
-uint8_t ICACHE_FLASH_ATTR ssd1305_measure_string(uint8_t id, char *str)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint8_t w = 0;
-    char c;
-
-    if (ctx == NULL)
-        return 0;
-
-    if (ctx->font == NULL)
-        return 0;
-
-    while (*str)
-    {
-        c = *str;
-        // we always have space in the font set
-        if ((c < ctx->font->char_start) || (c > ctx->font->char_end))
-            c = ' ';
-        c = c - ctx->font->char_start;   // c now become index to tables
-        w += ctx->font->char_descriptors[c].width;
-        ++str;
-       if (*str)
-           w += ctx->font->c;
-    }
-    return w;
-}
-
-
-uint8_t ICACHE_FLASH_ATTR ssd1305_get_font_height(uint8_t id)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-
-    if (ctx == NULL)
-        return 0;
-
-    if (ctx->font == NULL)
-        return 0;
-
-    return (ctx->font->height);
-}
-
-
-uint8_t ICACHE_FLASH_ATTR ssd1305_get_font_c(uint8_t id)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-
-    if (ctx == NULL)
-        return 0;
-
-    if (ctx->font == NULL)
-        return 0;
-
-    return (ctx->font->c);
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_invert_display(uint8_t id, bool invert)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-
-    if (ctx == NULL)
-        return;
-
-    if (invert)
-        _command(ctx->address, 0xa7); // SSD1305_INVERTDISPLAY
-    else
-        _command(ctx->address, 0xa6); // SSD1305_NORMALDISPLAY
-
-}
-
-
-void ICACHE_FLASH_ATTR ssd1305_update_buffer(uint8_t id, uint8_t* data, uint16_t length)
-{
-    oled_i2c_ctx *ctx = _ctxs[id];
-
-    if (ctx == NULL)
-        return;
-
-    if (ctx->type == SSD1305_128x64)
-    {
-        memcpy(ctx->buffer, data, (length < 1024) ? length : 1024);
-
-    }
-    ctx->refresh_right = ctx->width - 1;
-    ctx->refresh_bottom = ctx->height - 1;
-    ctx->refresh_top = 0;
-    ctx->refresh_left = 0;
-}
-
-
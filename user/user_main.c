@@ -12,6 +12,7 @@
 #include "shell.h"
 #include "xmit.h"
 #include "i2c.h"
+#include "i2c_bus.h"
 
 
 
@@ -61,6 +62,7 @@ void ICACHE_FLASH_ATTR user_init(void)
     uart_init();
     shell_init(uart0_putchar);
     i2c_init();
+    i2c_bus_init();
     wifi_init();
     xTaskCreate(shell_task, "shell", 256, NULL, tskIDLE_PRIORITY + 2, NULL);
 }